@@ -7,6 +7,7 @@
 #include <umm_malloc/umm_heap_select.h>
 // #include <AudioGeneratorMP3.h>
 #include <AudioOutputBuffer.h>
+#include <algorithm>
 #include <memory>
 
 String get_base_name(FsFile& file)
@@ -30,7 +31,7 @@ AudioManager& AudioManager::the()
 
 AudioManager::AudioManager()
 	: audio_source(card)
-	, audio_output(0, AudioOutputI2S::EXTERNAL_I2S, 8,
+	, audio_output(0, AudioOutputI2S::EXTERNAL_I2S, I2S_DMA_BUFFER_COUNT,
 		  AudioOutputI2S::APLL_DISABLE)
 {
 	timer.attach_ms(1, audio_timer_interrupt);
@@ -51,11 +52,9 @@ void error_callback(void*, int code, char const* string)
 	// debug_print(output.getString());
 }
 
-void AudioManager::play(String& file_name)
+void AudioManager::play(String& file_name, FadeSettings const& fade_in)
 {
-	if (audio_player)
-		audio_player->stop();
-	audio_source.close();
+	stop();
 
 	if (file_name.endsWith(F(".flac"))) {
 		audio_player = std::make_unique<AudioGeneratorFLAC>();
@@ -66,16 +65,45 @@ void AudioManager::play(String& file_name)
 	if (!audio_source.open(file_name.c_str())) {
 		return;
 	}
+	start(audio_source, fade_in);
+}
+
+void AudioManager::play_flac(AudioFileSourceReadAhead& source)
+{
+	stop();
+	audio_player = std::make_unique<AudioGeneratorFLAC>();
+	start(source, NO_FADE);
+}
+
+void AudioManager::stop()
+{
+	is_draining = false;
+	if (audio_player)
+		audio_player->stop();
+	audio_source.close();
+	// the caller's source may go away after this
+	the_playing_source = nullptr;
+}
+
+void AudioManager::start(AudioFileSourceReadAhead& source, FadeSettings const& fade_in)
+{
+	the_playing_source = &source;
 	audio_player->RegisterMetadataCB(&metadata_callback, nullptr);
 	audio_player->RegisterStatusCB(&error_callback, nullptr);
-	audio_player->begin(&audio_source, &audio_output);
+	the_pump_stats = {};
+	the_refill_threshold = 1;
+	is_pumping = false;
+	is_draining = false;
+	audio_output.gain().start_fade(fade_in);
+	audio_player->begin(&source, &audio_output);
 	debug_print(F("Audio: Starting playback"));
 }
 
 float AudioManager::current_position() const
 {
 	auto sample_rate = audio_output.sample_rate();
-	auto sample_count = audio_output.sample_count();
+	// samples still waiting in the ring buffer haven't been heard yet
+	auto sample_count = audio_output.sample_count() - std::min<size_t>(audio_output.queued_samples(), audio_output.sample_count());
 	return static_cast<float>(static_cast<double>(sample_count) / sample_rate);
 }
 
@@ -103,13 +131,78 @@ void AudioManager::loop()
 {
 	if (audio_player && audio_player->isRunning()) {
 		set_frequency(Frequency::Mhz160);
-		if (!audio_player->loop()) {
-			audio_player->stop();
-			debug_print(F("Audio: Track ended."));
-		}
+		pump();
+	} else if (is_draining) {
+		drain();
 	} else {
+		is_pumping = false;
 		set_frequency(Frequency::Mhz80);
 	}
 }
 
+void AudioManager::pump()
+{
+	uint32_t const now = micros();
+	if (is_pumping) {
+		uint32_t const stall = now - last_pump_time;
+		the_pump_stats.max_stall = std::max(the_pump_stats.max_stall, stall);
+		adaptation_max_stall = std::max(adaptation_max_stall, stall);
+		if (audio_output.is_starved()) {
+			++the_pump_stats.underruns;
+			// top up at every chance until the next adaptation
+			the_refill_threshold = 1;
+			adaptation_start_time = now;
+			adaptation_max_stall = 0;
+		}
+	} else {
+		is_pumping = true;
+		adaptation_start_time = now;
+		adaptation_max_stall = 0;
+	}
+	last_pump_time = now;
+
+	if (now - adaptation_start_time >= REFILL_ADAPTATION_PERIOD) {
+		adapt_refill_threshold();
+		adaptation_start_time = now;
+		adaptation_max_stall = 0;
+	}
+
+	// the generator decodes until the ring buffer is full, so running it for a few free samples mostly costs overhead
+	if (audio_output.free_samples() < the_refill_threshold * I2S_DMA_BUFFER_SAMPLES) {
+		++the_pump_stats.skipped_pumps;
+		return;
+	}
+
+	if (!audio_player->loop()) {
+		// stopping the output now would drop up to PCM_RING_CAPACITY samples of the end
+		is_draining = true;
+	} else {
+		// the decoder has filled the output buffer, so this is the time to read ahead
+		the_playing_source->fill();
+	}
+	++the_pump_stats.pumps;
+	the_pump_stats.total_pump_time += static_cast<uint32_t>(micros()) - now;
+}
+
+void AudioManager::drain()
+{
+	if (!audio_output.is_played_out())
+		return;
+	is_draining = false;
+	audio_player->stop();
+	debug_print(F("Audio: Track ended."));
+}
+
+void AudioManager::adapt_refill_threshold()
+{
+	auto const sample_rate = std::max(audio_output.sample_rate(), 1);
+	// DMA buffers that play during the longest stall, rounded up, plus one to spare
+	auto const stall_samples = static_cast<uint64_t>(adaptation_max_stall) * sample_rate / 1000000;
+	auto const stall_buffers = static_cast<uint32_t>((stall_samples + I2S_DMA_BUFFER_SAMPLES - 1) / I2S_DMA_BUFFER_SAMPLES) + 1;
+	// A skipped pump leaves more than PCM_RING_BLOCKS - threshold blocks in the ring buffer, and the DMA buffers are kept full.
+	constexpr auto queued_buffers = PCM_RING_BLOCKS + I2S_DMA_BUFFER_COUNT;
+	auto const threshold = stall_buffers < queued_buffers ? queued_buffers - stall_buffers : 1;
+	the_refill_threshold = std::clamp<uint32_t>(threshold, 1, MAX_REFILL_THRESHOLD);
+}
+
 void audio_timer_interrupt() { AudioManager::the().loop(); }
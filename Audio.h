@@ -3,12 +3,15 @@
 #pragma once
 
 #include "AudioFileSourceSdFs.h"
+#include "GainStage.h"
+#include "PcmRingOutput.h"
 #include <AudioGenerator.h>
 #include <AudioOutput.h>
 #include <AudioOutputI2S.h>
 #include <Ticker.h>
 #include <memory>
 
+// Counts the played samples and applies the software volume and fade-in.
 template <typename UnderlyingOutput>
 class SampleCounterOutput : public UnderlyingOutput {
 public:
@@ -17,10 +20,24 @@ public:
 
 	int sample_rate() const { return this->hertz; }
 	size_t sample_count() const { return the_sample_count; }
+	GainStage& gain() { return the_gain; }
+	GainStage const& gain() const { return the_gain; }
+
+	virtual bool SetRate(int hz) override
+	{
+		the_gain.set_sample_rate(hz);
+		return UnderlyingOutput::SetRate(hz);
+	}
 	virtual bool ConsumeSample(int16_t sample[2]) override
 	{
+		int16_t scaled_sample[2] = { sample[LEFTCHANNEL], sample[RIGHTCHANNEL] };
+		the_gain.apply(scaled_sample);
+		// the generator offers a rejected sample again later
+		if (!UnderlyingOutput::ConsumeSample(scaled_sample))
+			return false;
+		the_gain.advance();
 		the_sample_count++;
-		return UnderlyingOutput::ConsumeSample(sample);
+		return true;
 	}
 	virtual bool stop() override
 	{
@@ -30,6 +47,27 @@ public:
 
 private:
 	size_t the_sample_count { 0 };
+	GainStage the_gain;
+};
+
+// The decoder fills the PCM ring buffer in blocks of one DMA buffer.
+constexpr uint32_t PCM_RING_BLOCKS = PCM_RING_CAPACITY / I2S_DMA_BUFFER_SAMPLES;
+// Upper limit of the refill threshold, so that pumps still top up the ring buffer long before it runs dry.
+constexpr uint32_t MAX_REFILL_THRESHOLD = PCM_RING_BLOCKS / 2;
+// Period in microseconds after which the refill threshold is adapted to the longest stall in that period.
+constexpr uint32_t REFILL_ADAPTATION_PERIOD = 1000000;
+
+struct AudioPumpStats {
+	// pumps that ran the decoder, and pumps that were skipped since enough audio was still queued
+	uint32_t pumps { 0 };
+	uint32_t skipped_pumps { 0 };
+	// pumps that found the DMA buffers empty, i.e. the output ran dry since the previous pump
+	uint32_t underruns { 0 };
+	// longest time between two pumps in microseconds
+	uint32_t max_stall { 0 };
+	uint64_t total_pump_time { 0 };
+
+	uint32_t average_pump_time() const { return pumps > 0 ? static_cast<uint32_t>(total_pump_time / pumps) : 0; }
 };
 
 class AudioManager {
@@ -38,22 +76,67 @@ public:
 	AudioManager();
 
 	void loop();
-	bool is_playing() const { return audio_player && audio_player->isRunning(); }
+	// Also while the end of a track drains from the buffers.
+	bool is_playing() const { return (audio_player && audio_player->isRunning()) || is_draining; }
+
+	// Alarms pass their fade-in; everything else starts at full volume.
+	void play(String& file_name, FadeSettings const& fade_in = NO_FADE);
+	// Plays a FLAC stream from a source owned by the caller, which has to stay open until playback is stopped.
+	void play_flac(AudioFileSourceReadAhead& source);
+	void stop();
 
-	void play(String& file_name);
+	// Volume in percent. Changes ramp in over about 6ms of audio, also during a fade-in.
+	void set_volume(uint8_t percent) { audio_output.gain().set_volume(GainStage::volume_from_percent(percent)); }
+	uint8_t volume() const { return static_cast<uint8_t>((audio_output.gain().current_volume() * 100 + UNITY_GAIN / 2) / UNITY_GAIN); }
+	bool is_fading_in() const { return audio_output.gain().is_fading(); }
 
 	float current_position() const;
 	size_t played_sample_count() const { return audio_output.sample_count(); }
 	size_t sample_rate() const { return audio_output.sample_rate(); }
+	// read-ahead buffer of the played audio source
+	uint32_t buffered_bytes() const { return playing_source().fill_level(); }
+	ReadAheadStats const& read_ahead_stats() const { return playing_source().read_ahead_stats(); }
+	bool is_streaming_raw() const { return &playing_source() == &audio_source && audio_source.is_raw_mode(); }
+	AudioPumpStats const& pump_stats() const { return the_pump_stats; }
+	// number of free ring buffer blocks at which the decoder runs
+	uint32_t refill_threshold() const { return the_refill_threshold; }
+	uint32_t starved_buffers() const { return audio_output.starved_buffers(); }
 
 private:
 	// Singleton instance
 	static std::unique_ptr<AudioManager> instance;
 
+	void start(AudioFileSourceReadAhead& source, FadeSettings const& fade_in);
+	// the source of the current playback, or audio_source if there is none
+	AudioFileSourceReadAhead const& playing_source() const
+	{
+		if (the_playing_source)
+			return *the_playing_source;
+		return audio_source;
+	}
+	// Runs the decoder if enough ring buffer blocks are free, which then decodes until the ring buffer is full again.
+	void pump();
+	// Stops the output once the decoded end of the track has been played, instead of cutting off the buffered samples.
+	void drain();
+	// Picks the highest refill threshold at which the audio queued at a skipped pump outlasts the longest recent stall.
+	void adapt_refill_threshold();
+
 	AudioFileSourceSdFs audio_source;
-	SampleCounterOutput<AudioOutputI2S> audio_output;
+	// audio_source or the caller's source of play_flac, which the pumps read ahead
+	AudioFileSourceReadAhead* the_playing_source { nullptr };
+	SampleCounterOutput<PcmRingOutput> audio_output;
 	std::unique_ptr<AudioGenerator> audio_player;
 	Ticker timer;
+	// whether the decoder reached the end of the track, but the ring buffer and DMA buffers still play
+	bool is_draining { false };
+
+	AudioPumpStats the_pump_stats {};
+	uint32_t the_refill_threshold { 1 };
+	// whether the previous pump belongs to the current playback, so that the time since then is a stall
+	bool is_pumping { false };
+	uint32_t last_pump_time { 0 };
+	uint32_t adaptation_start_time { 0 };
+	uint32_t adaptation_max_stall { 0 };
 };
 
 // fake non-realtime cooperative "interrupt" invoked via yield()/delay()
@@ -0,0 +1,140 @@
+#include "AudioFileSourceReadAhead.h"
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <umm_malloc/umm_heap_select.h>
+
+void AudioFileSourceReadAhead::start_read_ahead()
+{
+	{
+		// the main heap is needed for the audio decoder
+		HeapSelectIram iram;
+		buffer.reset(new (std::nothrow) uint8_t[AUDIO_READ_AHEAD_SIZE]);
+	}
+	buffer_start = buffer_end = position = 0;
+	stats = {};
+}
+
+void AudioFileSourceReadAhead::stop_read_ahead()
+{
+	buffer.reset();
+	buffer_start = buffer_end = position = 0;
+}
+
+uint32_t AudioFileSourceReadAhead::refill()
+{
+	// never overwrite data that hasn't been read yet
+	uint32_t const free_space = AUDIO_READ_AHEAD_SIZE - std::min<uint32_t>(fill_level(), AUDIO_READ_AHEAD_SIZE);
+	uint32_t const offset = buffer_end % AUDIO_READ_AHEAD_SIZE;
+	// The buffer end is sector-aligned except at the end of the stream, and so is the end of the ring,
+	// so this reads whole sectors.
+	auto const length = std::min<uint32_t>({ free_space, AUDIO_READ_AHEAD_SIZE - offset, AUDIO_REFILL_SIZE }) / AUDIO_SECTOR_SIZE * AUDIO_SECTOR_SIZE;
+	if (length == 0)
+		return 0;
+
+	auto const bytes_read = read_stream(buffer.get() + offset, length);
+	// the read may have written all of the given space, overwriting older data
+	auto const written_end = buffer_end + length;
+	if (written_end - buffer_start > AUDIO_READ_AHEAD_SIZE)
+		buffer_start = written_end - AUDIO_READ_AHEAD_SIZE;
+	if (bytes_read <= 0)
+		return 0;
+	buffer_end += bytes_read;
+	++stats.refills;
+	return bytes_read;
+}
+
+bool AudioFileSourceReadAhead::restart_at(uint32_t new_position)
+{
+	auto const sector_start = new_position / AUDIO_SECTOR_SIZE * AUDIO_SECTOR_SIZE;
+	if (!restart_stream(sector_start))
+		return false;
+	// the position may lie up to a sector past the buffer end until the next refill
+	buffer_start = buffer_end = sector_start;
+	position = new_position;
+	return true;
+}
+
+void AudioFileSourceReadAhead::fill()
+{
+	if (!isOpen() || !buffer || buffer_end >= getSize())
+		return;
+	refill();
+}
+
+uint32_t AudioFileSourceReadAhead::read(void* data, uint32_t len)
+{
+	if (!isOpen())
+		return 0;
+	if (!buffer) {
+		auto const bytes_read = read_stream(static_cast<uint8_t*>(data), len);
+		if (bytes_read <= 0)
+			return 0;
+		position += bytes_read;
+		return bytes_read;
+	}
+
+	// reads at the end of the stream don't underrun, they are just short
+	auto const size = getSize();
+	auto const available = std::min(len, size - std::min(position, size));
+	if (fill_level() >= available) {
+		++stats.buffered_reads;
+	} else {
+		++stats.underruns;
+	}
+	if (available == len)
+		stats.min_fill_level = std::min(stats.min_fill_level, fill_level());
+
+	auto* output = static_cast<uint8_t*>(data);
+	uint32_t total_read = 0;
+	while (total_read < len) {
+		if (position >= buffer_end) {
+			if (refill() == 0)
+				break;
+			continue;
+		}
+		uint32_t const offset = position % AUDIO_READ_AHEAD_SIZE;
+		auto const length = std::min<uint32_t>({ len - total_read, buffer_end - position, AUDIO_READ_AHEAD_SIZE - offset });
+		memcpy(output + total_read, buffer.get() + offset, length);
+		position += length;
+		total_read += length;
+	}
+	return total_read;
+}
+
+bool AudioFileSourceReadAhead::seek(int32_t pos, int dir)
+{
+	if (!isOpen())
+		return false;
+
+	int64_t target = pos;
+	if (dir == SEEK_CUR)
+		target += position;
+	else if (dir == SEEK_END)
+		target += getSize();
+	else if (dir != SEEK_SET)
+		return false;
+	if (target < 0 || target > static_cast<int64_t>(getSize()))
+		return false;
+	if (!buffer) {
+		if (!restart_stream(static_cast<uint32_t>(target)))
+			return false;
+		position = static_cast<uint32_t>(target);
+		return true;
+	}
+
+	if (target >= buffer_start && target <= buffer_end) {
+		position = static_cast<uint32_t>(target);
+		++stats.buffered_seeks;
+		return true;
+	}
+	return restart_at(static_cast<uint32_t>(target));
+}
+
+uint32_t AudioFileSourceReadAhead::getPos()
+{
+	if (!isOpen())
+		return 0;
+
+	return position;
+}
@@ -0,0 +1,75 @@
+/*
+ * Base class of audio sources that read ahead into a ring buffer.
+ */
+
+#pragma once
+
+#include <AudioFileSource.h>
+#include <memory>
+#include <stdint.h>
+
+// Size of the read-ahead ring buffer, a multiple of the sector size so that all refills are aligned sector reads.
+constexpr uint32_t AUDIO_READ_AHEAD_SIZE = 4096;
+// Maximum amount of data read from the card per refill, which bounds the time that a refill takes.
+constexpr uint32_t AUDIO_REFILL_SIZE = 2048;
+constexpr uint32_t AUDIO_SECTOR_SIZE = 512;
+static_assert(AUDIO_READ_AHEAD_SIZE % AUDIO_SECTOR_SIZE == 0 && AUDIO_REFILL_SIZE % AUDIO_SECTOR_SIZE == 0);
+
+struct ReadAheadStats {
+	// reads that found too little data in the buffer and had to wait for the card
+	uint32_t underruns { 0 };
+	// reads and seeks that were served entirely from the buffer
+	uint32_t buffered_reads { 0 };
+	uint32_t buffered_seeks { 0 };
+	uint32_t refills { 0 };
+	// refills that read sectors straight from the card
+	uint32_t raw_reads { 0 };
+	// lowest number of bytes buffered ahead that a read found, since opening the file
+	uint32_t min_fill_level { UINT32_MAX };
+};
+
+// Serves the decoder's small reads from a ring buffer in the IRAM heap, which idle time tops up with large reads, so that
+// reads rarely wait for the card. Subclasses provide the stream through read_stream and restart_stream.
+class AudioFileSourceReadAhead : public AudioFileSource {
+public:
+	virtual ~AudioFileSourceReadAhead() override = default;
+
+	virtual uint32_t read(void* data, uint32_t len) override;
+	virtual bool seek(int32_t pos, int dir) override;
+	virtual uint32_t getPos() override;
+
+	// Reads ahead into the buffer if it has room for at least a sector. Meant for idle time, so that reads don't wait for the card.
+	void fill();
+	// Number of bytes buffered ahead of the current position.
+	uint32_t fill_level() const { return buffer_end > position ? buffer_end - position : 0; }
+	ReadAheadStats const& read_ahead_stats() const { return stats; }
+
+protected:
+	// Allocates the buffer and starts at the beginning of the stream; subclasses call this once their stream is open.
+	// If the buffer can't be allocated, reads go straight to the stream.
+	void start_read_ahead();
+	// Releases the buffer for other users of the IRAM heap, such as the video player.
+	void stop_read_ahead();
+	bool is_buffered() const { return buffer != nullptr; }
+
+	// Reads the stream where the previous read or restart_stream left off. Returns the number of bytes read, or a negative value on errors.
+	// When buffered, the data may fill all of the given length even if fewer bytes belong to the stream (e.g. whole sectors at the end of a file).
+	virtual int read_stream(uint8_t* data, uint32_t length) = 0;
+	// Continues the stream at the given position, which is sector-aligned when buffered.
+	virtual bool restart_stream(uint32_t new_position) = 0;
+
+	ReadAheadStats stats {};
+
+private:
+	// Reads up to AUDIO_REFILL_SIZE bytes into the buffer. Returns the number of bytes read.
+	uint32_t refill();
+	// Empties the buffer and continues reading from the sector that contains the given position.
+	bool restart_at(uint32_t new_position);
+
+	// Ring buffer of the stream data from buffer_start to buffer_end; each byte is at its stream position modulo the buffer size.
+	// Data before the current position stays around until it's overwritten, which serves short backwards seeks.
+	std::unique_ptr<uint8_t[]> buffer;
+	uint32_t buffer_start { 0 };
+	uint32_t buffer_end { 0 };
+	uint32_t position { 0 };
+};
@@ -1,5 +1,6 @@
 #include "AudioFileSourceSdFs.h"
 #include "PrintString.h"
+#include <algorithm>
 
 AudioFileSourceSdFs::AudioFileSourceSdFs(SdFs& card)
 	: card(card)
@@ -14,8 +15,19 @@ AudioFileSourceSdFs::AudioFileSourceSdFs(SdFs& card, const char* filename)
 
 bool AudioFileSourceSdFs::open(const char* filename)
 {
+	close();
 	f = card.open(filename, O_RDONLY);
-	return f;
+	if (!f)
+		return false;
+
+	start_read_ahead();
+	// Contiguous files are read straight from the card's sectors, which skips walking the FAT and the shared sector cache.
+	// (The file system already knows whether a file is contiguous, since USE_FAT_FILE_FLAG_CONTIGUOUS is enabled.)
+	// Raw reads are whole sectors, so they need the buffer.
+	uint32_t end_sector = 0;
+	is_raw = is_buffered() && f.contiguousRange(&first_sector, &end_sector);
+	raw_position = 0;
+	return true;
 }
 
 AudioFileSourceSdFs::~AudioFileSourceSdFs()
@@ -24,29 +36,47 @@ AudioFileSourceSdFs::~AudioFileSourceSdFs()
 		f.close();
 }
 
-uint32_t AudioFileSourceSdFs::read(void* data, uint32_t len)
+int AudioFileSourceSdFs::read_stream(uint8_t* data, uint32_t length)
 {
-	if (!f)
+	return is_raw ? read_sectors(data, length) : f.read(data, length);
+}
+
+int AudioFileSourceSdFs::read_sectors(uint8_t* data, uint32_t length)
+{
+	// the last sector of the file is read in full, but only the part that belongs to the file counts
+	auto const file_size = static_cast<uint32_t>(f.size());
+	auto const bytes_left = file_size > raw_position ? file_size - raw_position : 0;
+	auto const sector_count = std::min(length, bytes_left + AUDIO_SECTOR_SIZE - 1) / AUDIO_SECTOR_SIZE;
+	if (sector_count == 0)
 		return 0;
 
-	return f.read(static_cast<uint8_t*>(data), len);
+	if (!card.card()->readSectors(first_sector + raw_position / AUDIO_SECTOR_SIZE, data, sector_count)) {
+		// the file system may still manage, e.g. after a card error that a retry fixes
+		is_raw = false;
+		if (!f.seek(raw_position))
+			return -1;
+		return f.read(data, length);
+	}
+	++stats.raw_reads;
+	auto const bytes_read = std::min(sector_count * AUDIO_SECTOR_SIZE, bytes_left);
+	raw_position += bytes_read;
+	return bytes_read;
 }
 
-bool AudioFileSourceSdFs::seek(int32_t pos, int dir)
+bool AudioFileSourceSdFs::restart_stream(uint32_t new_position)
 {
-	if (!f)
-		return false;
-	if (dir == SEEK_SET)
-		return f.seek(pos);
-	else if (dir == SEEK_CUR)
-		return f.seek(f.position() + pos);
-	else if (dir == SEEK_END)
-		return f.seek(f.size() + pos);
-	return false;
+	// raw reads don't use the file position
+	if (is_raw) {
+		raw_position = new_position;
+		return true;
+	}
+	return f.seek(new_position);
 }
 
 bool AudioFileSourceSdFs::close()
 {
+	stop_read_ahead();
+	is_raw = false;
 	if (!f)
 		return false;
 
@@ -64,14 +94,6 @@ uint32_t AudioFileSourceSdFs::getSize()
 	return f.size();
 }
 
-uint32_t AudioFileSourceSdFs::getPos()
-{
-	if (!f)
-		return 0;
-
-	return f.position();
-}
-
 String AudioFileSourceSdFs::file_name() const
 {
 	if (!f)
@@ -2,26 +2,39 @@
  * Adjusted version of AudioFileSourceSD that works with SdFs.
  */
 
-#include <AudioFileSource.h>
+#include "AudioFileSourceReadAhead.h"
 #include <SdFat.h>
 
-class AudioFileSourceSdFs : public AudioFileSource {
+class AudioFileSourceSdFs : public AudioFileSourceReadAhead {
 public:
 	AudioFileSourceSdFs(SdFs& card);
 	AudioFileSourceSdFs(SdFs& card, const char* filename);
 	virtual ~AudioFileSourceSdFs() override;
 
 	virtual bool open(const char* filename) override;
-	virtual uint32_t read(void* data, uint32_t len) override;
-	virtual bool seek(int32_t pos, int dir) override;
 	virtual bool close() override;
 	virtual bool isOpen() override;
 	virtual uint32_t getSize() override;
-	virtual uint32_t getPos() override;
 
 	String file_name() const;
 
+	// Whether the file is contiguous and read without the file system.
+	bool is_raw_mode() const { return is_raw; }
+
+protected:
+	virtual int read_stream(uint8_t* data, uint32_t length) override;
+	virtual bool restart_stream(uint32_t new_position) override;
+
 private:
+	// Reads whole sectors at the raw position straight from the card.
+	// Switches back to reading through the file system if the card read fails.
+	int read_sectors(uint8_t* data, uint32_t length);
+
 	SdFs& card;
 	FsFile f;
+
+	bool is_raw { false };
+	uint32_t first_sector { 0 };
+	// file position of the next raw read, since raw reads don't move the file's position
+	uint32_t raw_position { 0 };
 };
@@ -3,6 +3,7 @@
 #include "Definitions.h"
 #include "DisplayUtils.h"
 #include "LUTMath.h"
+#include "YieldBudget.h"
 #include "graphics.h"
 
 namespace ClockFaces {
@@ -13,7 +14,7 @@ static uint8_t get_center(uint8_t start, uint8_t size)
 }
 
 void basic_digital(Display* display, ace_time::ZonedDateTime* time, double,
-	uint8_t x0, uint8_t y0, uint8_t width, uint8_t height)
+	uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, YieldBudget& budget)
 {
 	auto hour = time->hour();
 	if (eeprom_settings.clock_settings.time_format != TimeFormat::Hours24) {
@@ -24,7 +25,7 @@ void basic_digital(Display* display, ace_time::ZonedDateTime* time, double,
 
 	char time_text[6];
 	snprintf_P(time_text, sizeof(time_text), PSTR("%02u:%02u"), hour, time->minute());
-	yield();
+	budget.check();
 
 	display->setFont(CLOCK_FONT);
 	uint16_t text_width = display->getUTF8Width(time_text);
@@ -37,13 +38,13 @@ void basic_digital(Display* display, ace_time::ZonedDateTime* time, double,
 		display->setFont(CLOCK_FONT);
 	}
 
-	yield();
+	budget.check();
 	uint16_t text_start = text_width > width ? x0 : (width - text_width) / 2 + x0;
 	display->drawUTF8(text_start, (height + CLOCK_FONT_HEIGHT) / 2 + y0, time_text);
 	text_start += display->getUTF8Width(time_text) + LEFT_TEXT_MARGIN;
 
 	if (eeprom_settings.clock_settings.show_seconds) {
-		yield();
+		budget.check();
 		display->setFont(MAIN_FONT);
 		display->drawUTF8(text_start,
 			(height + CLOCK_FONT_HEIGHT) / 2 + y0, second_text);
@@ -51,7 +52,7 @@ void basic_digital(Display* display, ace_time::ZonedDateTime* time, double,
 	}
 
 	if (eeprom_settings.clock_settings.time_format == TimeFormat::Hours12AmPm) {
-		yield();
+		budget.check();
 		display->setFont(MAIN_FONT);
 		display->drawUTF8(text_start,
 			(height + CLOCK_FONT_HEIGHT) / 2 + y0, time->hour() < 12 ? am : pm);
@@ -59,7 +60,7 @@ void basic_digital(Display* display, ace_time::ZonedDateTime* time, double,
 }
 
 void basic_analog(Display* display, ace_time::ZonedDateTime* time, double second_fractions,
-	uint8_t x0, uint8_t y0, uint8_t width, uint8_t height)
+	uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, YieldBudget& budget)
 {
 	const double hour = time->hour() + time->minute() / 60.0d,
 				 minute = time->minute() + time->second() / 60.0d,
@@ -74,7 +75,7 @@ void basic_analog(Display* display, ace_time::ZonedDateTime* time, double second
 					 outerX = (cos_lut(i - HALF_PI) * ANALOG_CLOCK_FACE_SIZE / 2),
 					 outerY = (sin_lut(i - HALF_PI) * ANALOG_CLOCK_FACE_SIZE / 2);
 
-		yield();
+		budget.check();
 		display->drawLine(inner_x + center_x, inner_y + center_y, outerX + center_x,
 			outerY + center_y);
 	}
@@ -88,19 +89,19 @@ void basic_analog(Display* display, ace_time::ZonedDateTime* time, double second
 	if (eeprom_settings.clock_settings.show_seconds)
 		display->drawLine(center_x, center_y, center_x + secOuterX, center_y + secOuterY);
 
-	yield();
+	budget.check();
 	display->drawLine(center_x, center_y,
 		cos_lut(minuteAngle) * ANALOG_CLOCK_FACE_MINUTE_LENGTH + center_x,
 		sin_lut(minuteAngle) * ANALOG_CLOCK_FACE_MINUTE_LENGTH + center_y);
 
-	yield();
+	budget.check();
 	display->drawLine(center_x, center_y,
 		cos_lut(hourAngle) * ANALOG_CLOCK_FACE_HOUR_LENGTH + center_x,
 		sin_lut(hourAngle) * ANALOG_CLOCK_FACE_HOUR_LENGTH + center_y);
 }
 
 void modern_analog(Display* display, ace_time::ZonedDateTime* time, double second_fractions,
-	uint8_t x0, uint8_t y0, uint8_t width, uint8_t height)
+	uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, YieldBudget& budget)
 {
 	const auto inner_radius = ANALOG_CLOCK_FACE_LINE_LENGTH / 2.;
 
@@ -110,7 +111,7 @@ void modern_analog(Display* display, ace_time::ZonedDateTime* time, double secon
 	const uint16_t center_x = get_center(x0, width),
 				   center_y = get_center(y0, height);
 
-	yield();
+	budget.check();
 	display->drawDisc(center_x, center_y, inner_radius);
 
 	display->setFont(u8g2_font_mozart_nbp_tf);
@@ -118,7 +119,7 @@ void modern_analog(Display* display, ace_time::ZonedDateTime* time, double secon
 		const double angle = i * PI_DIV6;
 		const double outerX = (cos_lut(angle - HALF_PI) * ANALOG_CLOCK_FACE_SIZE / 2),
 					 outerY = (sin_lut(angle - HALF_PI) * ANALOG_CLOCK_FACE_SIZE / 2);
-		yield();
+		budget.check();
 		const char* number = hour_names_modern[i];
 		const auto width = display->getUTF8Width(number);
 		display->drawUTF8(center_x + outerX - width / 2 + 1, center_y + outerY + 7 / 2, number);
@@ -136,7 +137,7 @@ void modern_analog(Display* display, ace_time::ZonedDateTime* time, double secon
 		counter_hand_minute_x = cos_lut(minuteAngle) * (ANALOG_CLOCK_FACE_MINUTE_LENGTH + inner_radius) + center_x;
 
 	display->drawLine(center_x, center_y, minute_x, minute_y);
-	yield();
+	budget.check();
 	draw_stroked_line(display, center_x, center_y, hour_x, hour_y, hourAngle + HALF_PI, 3);
 
 	if (eeprom_settings.clock_settings.show_seconds) {
@@ -151,7 +152,7 @@ void modern_analog(Display* display, ace_time::ZonedDateTime* time, double secon
 }
 
 void retro_analog(Display* display, ace_time::ZonedDateTime* time, double second_fractions,
-	uint8_t x0, uint8_t y0, uint8_t width, uint8_t height)
+	uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, YieldBudget& budget)
 {
 	const auto inner_radius = ANALOG_CLOCK_FACE_LINE_LENGTH / 3.;
 
@@ -161,7 +162,7 @@ void retro_analog(Display* display, ace_time::ZonedDateTime* time, double second
 	const uint16_t center_x = get_center(x0, width),
 				   center_y = get_center(y0, height);
 
-	yield();
+	budget.check();
 	display->drawDisc(center_x, center_y, inner_radius);
 
 	display->setFont(TINY_FONT);
@@ -169,7 +170,7 @@ void retro_analog(Display* display, ace_time::ZonedDateTime* time, double second
 		const double angle = i * PI_DIV6;
 		const double outerX = (cos_lut(angle - HALF_PI) * ANALOG_CLOCK_FACE_SIZE / 2),
 					 outerY = (sin_lut(angle - HALF_PI) * ANALOG_CLOCK_FACE_SIZE / 2);
-		yield();
+		budget.check();
 		const char* number = hour_names_retro[i];
 		const auto width = display->getUTF8Width(number);
 		display->drawUTF8(center_x + outerX - width / 2 + 1, center_y + outerY + 7 / 2, number);
@@ -200,7 +201,7 @@ void retro_analog(Display* display, ace_time::ZonedDateTime* time, double second
 	display->drawLine(minute_opposite_x, minute_opposite_y, minute_x, minute_y);
 	display->drawLine(minute_right_side_x, minute_right_side_y, minute_x, minute_y);
 	display->drawLine(minute_x, minute_y, minute_left_side_x, minute_left_side_y);
-	yield();
+	budget.check();
 	display->drawLine(hour_opposite_x, hour_opposite_y, hour_x, hour_y);
 	display->drawLine(hour_right_side_x, hour_right_side_y, hour_x, hour_y);
 	display->drawLine(hour_x, hour_y, hour_left_side_x, hour_left_side_y);
@@ -212,7 +213,7 @@ void retro_analog(Display* display, ace_time::ZonedDateTime* time, double second
 
 void rotating_segment_analog(Display* display, ace_time::ZonedDateTime* time, double second_fractions,
 	uint8_t x0, uint8_t y0, uint8_t width,
-	uint8_t height)
+	uint8_t height, YieldBudget& budget)
 {
 	const double hour = time->hour() + time->minute() / 60.0d,
 				 minute = time->minute() + time->second() / 60.0d,
@@ -233,19 +234,19 @@ void rotating_segment_analog(Display* display, ace_time::ZonedDateTime* time, do
 	const double minuteOffset = fmod(-millis() / 1400.0d / VRAND1, TWO_PI);
 	const double hourOffset = fmod(millis() / 2600.0d / VRAND2, TWO_PI);
 
-	yield();
+	budget.check();
 	draw_arc(display, center_x, center_y, height / 2 - LINESEP * 2, secondOffset,
 		secondOffset + secondAngle);
-	yield();
+	budget.check();
 	draw_arc(display, center_x, center_y, height / 2 - LINESEP * 4, minuteOffset,
 		minuteOffset + minuteAngle);
-	yield();
+	budget.check();
 	draw_arc(display, center_x, center_y, height / 2 - LINESEP * 8, hourOffset,
 		hourOffset + hourAngle);
 }
 
 void binary(Display* display, ace_time::ZonedDateTime* time, double, uint8_t x0,
-	uint8_t y0, uint8_t width, uint8_t height)
+	uint8_t y0, uint8_t width, uint8_t height, YieldBudget& budget)
 {
 	const uint8_t hour = time->hour(), minute = time->minute(),
 				  second = time->second();
@@ -256,7 +257,7 @@ void binary(Display* display, ace_time::ZonedDateTime* time, double, uint8_t x0,
 	// maximum of 6 bits for minute/second, 5 bits for hour, go with one
 	// 6-bit-loop
 	for (uint8_t bit = 0; bit < 6; ++bit) {
-		yield();
+		budget.check();
 		if (hour & (1 << bit)) {
 			display->drawBox(bit * (BINARY_CLOCK_FACE_BOX_SIZE + BINARY_CLOCK_FACE_BOX_SPACING) + BINARY_CLOCK_FACE_BOX_SPACING + x0,
 				hourpos, BINARY_CLOCK_FACE_BOX_SIZE, BINARY_CLOCK_FACE_BOX_SIZE);
@@ -273,7 +274,7 @@ void binary(Display* display, ace_time::ZonedDateTime* time, double, uint8_t x0,
 }
 
 void day_seconds_binary(Display* display, ace_time::ZonedDateTime* time, double,
-	uint8_t x0, uint8_t y0, uint8_t width, uint8_t height)
+	uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, YieldBudget& budget)
 {
 	const uint32_t second = time->second() + time->minute() * 60 + time->hour() * 60 * 24;
 
@@ -281,7 +282,7 @@ void day_seconds_binary(Display* display, ace_time::ZonedDateTime* time, double,
 	// maximum of 17 bits for second of day
 	for (uint16_t current_x = BINARY_CLOCK_FACE_BOX_SPACING, bit = 0; bit < 17;
 		 ++bit, current_x += BINARY_CLOCK_FACE_BOX_SPACING + BINARY_CLOCK_FACE_BOX_SIZE) {
-		yield();
+		budget.check();
 		// "line wrap" if boxes would overshoot the screen width
 		if (current_x + BINARY_CLOCK_FACE_BOX_SIZE > width) {
 			current_x = BINARY_CLOCK_FACE_BOX_SPACING;
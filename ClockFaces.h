@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Definitions.h"
+#include "YieldBudget.h"
 #include "string_constants.h"
 #include <AceTime.h>
 #include <U8g2lib.h>
@@ -28,22 +29,23 @@ constexpr uint16_t BINARY_CLOCK_FACE_BOX_SPACING = 2;
 constexpr uint8_t BINARY_CLOCK_FACE_MAX_BOXES_PER_ROW = static_cast<uint8_t>(SCREEN_WIDTH / (BINARY_CLOCK_FACE_BOX_SIZE + BINARY_CLOCK_FACE_BOX_SPACING));
 
 // typedef the clock face function pointer type
-using ClockFace = void (*)(Display*, ace_time::ZonedDateTime*, double second_fractions, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height);
+// Faces check the yield budget of the page loop that draws them, so that the whole page shares one budget.
+using ClockFace = void (*)(Display*, ace_time::ZonedDateTime*, double second_fractions, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, YieldBudget&);
 
 /** Basic digital clock. */
-void basic_digital(Display* display, ace_time::ZonedDateTime* time, double, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height);
+void basic_digital(Display* display, ace_time::ZonedDateTime* time, double, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, YieldBudget& budget);
 /** Minimalistic analog clock without numbers. */
-void basic_analog(Display* display, ace_time::ZonedDateTime* time, double, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height);
+void basic_analog(Display* display, ace_time::ZonedDateTime* time, double, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, YieldBudget& budget);
 /** Retro analog clock with Roman numerals. */
-void retro_analog(Display* display, ace_time::ZonedDateTime* time, double, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height);
+void retro_analog(Display* display, ace_time::ZonedDateTime* time, double, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, YieldBudget& budget);
 /** Modern analog clock with numbers. */
-void modern_analog(Display* display, ace_time::ZonedDateTime* time, double, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height);
+void modern_analog(Display* display, ace_time::ZonedDateTime* time, double, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, YieldBudget& budget);
 /** Analog clock with rotating segments for each time division. */
-void rotating_segment_analog(Display* display, ace_time::ZonedDateTime* time, double, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height);
+void rotating_segment_analog(Display* display, ace_time::ZonedDateTime* time, double, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, YieldBudget& budget);
 /** Binary clock that shows hour, minute and second in binary form: as horizontally stacked blocks. */
-void binary(Display* display, ace_time::ZonedDateTime* time, double, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height);
+void binary(Display* display, ace_time::ZonedDateTime* time, double, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, YieldBudget& budget);
 /** Binary clock that shows seconds of day in binary form. Not very useful but fun to look at. */
-void day_seconds_binary(Display* display, ace_time::ZonedDateTime* time, double, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height);
+void day_seconds_binary(Display* display, ace_time::ZonedDateTime* time, double, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, YieldBudget& budget);
 
 static std::array<ClockFace, 7> clock_faces {
 	&basic_digital,
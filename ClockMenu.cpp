@@ -3,6 +3,7 @@
 #include "Globals.h"
 #include "Settings.h"
 #include "TimeManager.h"
+#include "YieldBudget.h"
 #include "graphics.h"
 #include <ESP8266WiFi.h>
 #include <NTPClient.h>
@@ -31,6 +32,7 @@ Menu* ClockMenu::draw_menu(Display* display, uint16_t delta_millis)
 	}
 	double micros_in_second = static_cast<double>(micros64() - time_of_second_rollover) / 1'000'000.0d;
 
+	YieldBudget budget { YieldSubsystem::ClockFaces };
 	display->firstPage();
 	do {
 		display->setDrawColor(1);
@@ -45,7 +47,7 @@ Menu* ClockMenu::draw_menu(Display* display, uint16_t delta_millis)
 				nowifi_symbol_height, nowifi_symbol_bits);
 			current_symbol_position -= nowifi_symbol_width + SYMBOL_SPACING;
 		}
-		yield();
+		budget.check();
 
 		// TODO: display alarm clock symbol if an alarm clock is set
 
@@ -55,26 +57,26 @@ Menu* ClockMenu::draw_menu(Display* display, uint16_t delta_millis)
 				clocksync_symbol_bits);
 			current_symbol_position -= clocksync_symbol_width + SYMBOL_SPACING;
 		}
-		yield();
+		budget.check();
 
 		if (AudioManager::the().is_playing()) {
 			display->drawXBMP(current_symbol_position - sound_symbol_width, 0, sound_symbol_width,
 				sound_symbol_height, sound_symbol_bits);
 			current_symbol_position -= sound_symbol_width + SYMBOL_SPACING;
 		}
-		yield();
+		budget.check();
 
 		uint64_t time = micros64();
 		current_clock_face(display, &current_time, micros_in_second, 0, 0, display->getDisplayWidth(),
-			display->getDisplayHeight());
-		yield();
+			display->getDisplayHeight(), budget);
+		budget.check();
 
 		if (eeprom_settings.clock_settings.date_format != DateFormat::None) {
 			display->setFont(TINY_FONT);
 			display->drawUTF8(LEFT_TEXT_MARGIN, SCREEN_HEIGHT, date_text.c_str());
 		}
 		uint64_t after_time = micros64();
-		yield();
+		budget.check();
 
 		if (eeprom_settings.show_debug) {
 			uint64_t total_time = after_time - time;
@@ -87,7 +89,7 @@ Menu* ClockMenu::draw_menu(Display* display, uint16_t delta_millis)
 				timing_text);
 		}
 
-		yield();
+		budget.check();
 	} while (display->nextPage());
 
 	return this;
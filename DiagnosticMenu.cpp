@@ -5,6 +5,7 @@
 #include "NTPClient.h"
 #include "PrintString.h"
 #include "TimeManager.h"
+#include "YieldBudget.h"
 #include "string_constants.h"
 #include <AceTime.h>
 #include <SdFat.h>
@@ -67,6 +68,48 @@ Menu* DiagnosticMenu::draw_menu(Display* display, uint16_t delta_millis)
 
 			break;
 		}
+		case DiagnosticPage::Yields: {
+			this->dirty = true;
+
+			auto const& video = yield_stats_for(YieldSubsystem::Video);
+			auto const& drawing = yield_stats_for(YieldSubsystem::Drawing);
+			auto const& clock_faces = yield_stats_for(YieldSubsystem::ClockFaces);
+			char yield_info_text[128] {};
+			snprintf_P(yield_info_text, sizeof(yield_info_text),
+				PSTR("yields / checks\nvideo %u / %u\ndraw %u / %u\nclock %u / %u"),
+				video.yields, video.checks, drawing.yields, drawing.checks, clock_faces.yields, clock_faces.checks);
+			display->setFont(TINY_FONT);
+			draw_string(display, yield_info_text, 0);
+			break;
+		}
+		case DiagnosticPage::AudioBuffer: {
+			this->dirty = true;
+
+			auto const& stats = AudioManager::the().read_ahead_stats();
+			char buffer_info_text[128] {};
+			snprintf_P(buffer_info_text, sizeof(buffer_info_text),
+				PSTR("audio read-ahead (%s)\nfill %u / %u min %u\nunderruns %u ok %u\nrefills %u raw %u seeks %u"),
+				AudioManager::the().is_streaming_raw() ? "raw" : "fat",
+				AudioManager::the().buffered_bytes(), AUDIO_READ_AHEAD_SIZE,
+				stats.min_fill_level == UINT32_MAX ? 0 : stats.min_fill_level,
+				stats.underruns, stats.buffered_reads, stats.refills, stats.raw_reads, stats.buffered_seeks);
+			display->setFont(TINY_FONT);
+			draw_string(display, buffer_info_text, 0);
+			break;
+		}
+		case DiagnosticPage::AudioPump: {
+			this->dirty = true;
+
+			auto const& stats = AudioManager::the().pump_stats();
+			char pump_info_text[128] {};
+			snprintf_P(pump_info_text, sizeof(pump_info_text),
+				PSTR("audio pump\nruns %u skipped %u\nunderruns %u starved %u\nstall %uus avg %uus\nrefill at %u/%u"),
+				stats.pumps, stats.skipped_pumps, stats.underruns, AudioManager::the().starved_buffers(), stats.max_stall,
+				stats.average_pump_time(), AudioManager::the().refill_threshold(), PCM_RING_BLOCKS);
+			display->setFont(TINY_FONT);
+			draw_string(display, pump_info_text, 0);
+			break;
+		}
 		case DiagnosticPage::__Count:
 		default: {
 			this->current_page = DiagnosticPage::Time;
@@ -6,6 +6,9 @@
 enum class DiagnosticPage : uint8_t {
 	Time,
 	FileSystem,
+	Yields,
+	AudioBuffer,
+	AudioPump,
 	__Count,
 };
 
@@ -1,5 +1,7 @@
 #include "DisplayUtils.h"
 #include "LUTMath.h"
+#include "Span.h"
+#include "YieldBudget.h"
 
 void draw_rotated_xbm(Display* display, uint16_t x_start, uint16_t y_start,
 	double angle, uint16_t w, uint16_t h,
@@ -58,6 +60,7 @@ void draw_arc(Display* display, uint16_t x0, uint16_t y0, uint16_t radius, doubl
 			display->drawPixel(x0 + x, y0 + y);
 	};
 
+	YieldBudget budget { YieldSubsystem::Drawing };
 	// Bresenham for circles
 	auto f = 1 - radius;
 	auto ddF_x = 0;
@@ -93,7 +96,7 @@ void draw_arc(Display* display, uint16_t x0, uint16_t y0, uint16_t radius, doubl
 		draw(-y, +x);
 		draw(+y, -x);
 		draw(-y, -x);
-		yield();
+		budget.check();
 	}
 }
 
@@ -129,7 +132,7 @@ struct Point {
 };
 static_assert(sizeof(Point) == sizeof(uint16_t));
 
-// adjacent point for drawing a double thickness line
+// adjacent point for drawing a double thickness line; only readable with read_progmem, since the points are smaller than a word
 const Point adjacency[] PROGMEM = {
 	{ 1, 0 },
 	{ 1, 1 },
@@ -148,12 +151,12 @@ int8_t point_index(double angle)
 
 Point adjacent_point_for(double angle)
 {
-	return adjacency[point_index(angle)];
+	return read_progmem(&adjacency[point_index(angle)]);
 }
 
 Point previous_adjacent_point_for(double angle)
 {
-	return adjacency[(point_index(angle) + 9) % 8];
+	return read_progmem(&adjacency[(point_index(angle) + 9) % 8]);
 }
 
 void draw_stroked_line(Display* display, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, double angle, uint8_t stroke_width)
@@ -6,6 +6,7 @@
 #include "string_constants.h"
 #include <SdFat.h>
 #include <memory>
+#include <umm_malloc/umm_heap_select.h>
 #include <stdint.h>
 
 FileSelectMenu::FileSelectMenu(FileMenuState operation)
@@ -128,6 +129,8 @@ Menu* FileSelectMenu::handle_button(uint8_t buttons)
 			if (child.isDirectory()) {
 				current_directory = menu_selected_file;
 				update_directory();
+			} else if (operation == FileMenuState::None && menu_selected_file.endsWith(F(".srlv"))) {
+				return open_video(menu_selected_file);
 			} else {
 				perform_file_action(menu_selected_file);
 			}
@@ -176,6 +179,15 @@ void FileSelectMenu::perform_file_action(String chosen_file)
 	}
 }
 
+Menu* FileSelectMenu::open_video(String chosen_file)
+{
+	// replacing the previous player closes its video and stops its audio track
+	HeapSelectIram iram;
+	video_player = std::make_unique<VideoPlayer>(chosen_file);
+	video_player->parent = this;
+	return video_player.get();
+}
+
 void FileSelectMenu::perform_delete(YesNoSelection selection)
 {
 	bool could_delete = true;
@@ -6,6 +6,7 @@
 #include "Menu.h"
 #include "OptionsMenu.h"
 #include "SettingsMenu.h"
+#include "VideoPlayer.h"
 #include <Arduino.h>
 #include <U8g2lib.h>
 #include <vector>
@@ -44,6 +45,8 @@ private:
 	void ICACHE_FLASH_ATTR update_directory();
 
 	void ICACHE_FLASH_ATTR perform_file_action(String chosen_file);
+	// Returns the player for the chosen video, which becomes the active menu.
+	Menu* ICACHE_FLASH_ATTR open_video(String chosen_file);
 	void ICACHE_FLASH_ATTR perform_delete(YesNoSelection selection);
 	void ICACHE_FLASH_ATTR perform_move(YesNoSelection selection);
 
@@ -56,4 +59,6 @@ private:
 
 	String source_file = "";
 	String target_file = "";
+	// player of the last video chosen in the file view
+	std::unique_ptr<VideoPlayer> video_player {};
 };
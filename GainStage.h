@@ -0,0 +1,135 @@
+/** Fixed-point software volume and fade-in for the audio output. */
+
+#pragma once
+
+#include "Span.h"
+#include <stdint.h>
+
+// Q15 gain at which samples pass unchanged.
+constexpr int32_t UNITY_GAIN = 1 << 15;
+// Number of samples over which the gain ramps linearly towards the next target, so that volume changes don't click.
+// 256 samples are 6ms at 44.1kHz.
+constexpr uint32_t GAIN_BLOCK_SAMPLES = 256;
+
+// Shape of a fade-in, from silence at the start to full volume at the end.
+enum class FadeCurve : uint8_t {
+	Linear,
+	// Starts slowly, which matches loudness perception better than a linear fade.
+	Quadratic,
+	// Stays quiet for longer, for gentle wake-ups.
+	Cubic,
+	// Starts and ends slowly.
+	SmoothStep,
+};
+
+// Fade-in settings, e.g. of an alarm.
+struct FadeSettings {
+	// No fade if zero.
+	uint16_t duration_seconds = 30;
+	FadeCurve curve = FadeCurve::Quadratic;
+};
+
+constexpr FadeSettings NO_FADE { 0, FadeCurve::Linear };
+
+// Evaluates a fade curve at a Q15 progress between 0 and UNITY_GAIN.
+constexpr int32_t fade_curve_gain(FadeCurve curve, int32_t progress)
+{
+	auto const square = static_cast<uint32_t>(progress * progress) >> 15;
+	switch (curve) {
+	case FadeCurve::Quadratic:
+		return static_cast<int32_t>(square);
+	case FadeCurve::Cubic:
+		return static_cast<int32_t>((square * static_cast<uint32_t>(progress)) >> 15);
+	case FadeCurve::SmoothStep:
+		// 3p^2 - 2p^3
+		return static_cast<int32_t>((square * static_cast<uint32_t>(3 * UNITY_GAIN - 2 * progress)) >> 15);
+	case FadeCurve::Linear:
+	default:
+		return progress;
+	}
+}
+
+// Scales stereo samples by the product of the volume and the fade-in, both Q15 gains. The target gain is only computed once per block;
+// per sample, the gain moves by a constant step and each channel takes one multiplication, since the ESP8266 has no FPU.
+class GainStage {
+public:
+	// Changes the volume, ramping towards it from the next block on.
+	void set_volume(int32_t new_volume) { volume = new_volume < 0 ? 0 : (new_volume > UNITY_GAIN ? UNITY_GAIN : new_volume); }
+	int32_t current_volume() const { return volume; }
+	static constexpr int32_t volume_from_percent(uint8_t percent) { return (percent > 100 ? 100 : percent) * UNITY_GAIN / 100; }
+
+	// Restarts from silence and fades in to the volume, or jumps to the volume without a fade.
+	void start_fade(FadeSettings const& settings)
+	{
+		fade_length = clamp_fade_length(static_cast<uint64_t>(settings.duration_seconds) * sample_rate);
+		fade_position = 0;
+		fade_curve = settings.curve;
+		block_target = gain = fade_length > 0 ? 0 : static_cast<uint32_t>(volume) << 16;
+		gain_step = 0;
+		block_remaining = 0;
+	}
+	bool is_fading() const { return fade_position < fade_length; }
+
+	// The fade duration is given in seconds, so its length in samples depends on the sample rate.
+	void set_sample_rate(uint32_t new_sample_rate)
+	{
+		if (new_sample_rate == 0 || new_sample_rate == sample_rate)
+			return;
+		// keep the fade's progress
+		fade_position = static_cast<uint32_t>(static_cast<uint64_t>(fade_position) * new_sample_rate / sample_rate);
+		fade_length = clamp_fade_length(static_cast<uint64_t>(fade_length) * new_sample_rate / sample_rate);
+		sample_rate = new_sample_rate;
+	}
+
+	// Scales a sample with the current gain. Since the output may reject the sample, the gain only moves on with advance().
+	ALWAYS_INLINE void apply(int16_t sample[2]) const
+	{
+		auto const q15_gain = static_cast<int32_t>(gain >> 16);
+		// |sample * gain| stays below 2^30, and the result within the sample's range
+		sample[0] = static_cast<int16_t>((sample[0] * q15_gain) >> 15);
+		sample[1] = static_cast<int16_t>((sample[1] * q15_gain) >> 15);
+	}
+
+	ALWAYS_INLINE void advance()
+	{
+		if (block_remaining == 0)
+			start_block();
+		--block_remaining;
+		// two's complement makes adding the unsigned step a subtraction for negative steps
+		gain += static_cast<uint32_t>(gain_step);
+	}
+
+private:
+	// Long fades at high sample rates exceed 32 bits (e.g. 0xFFFF seconds at 96kHz), so they end after 2^32 - 1 samples instead,
+	// which is still more than 12 hours.
+	static constexpr uint32_t clamp_fade_length(uint64_t length) { return length > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(length); }
+
+	// Sets up the ramp towards the gain at the end of the next block.
+	void start_block()
+	{
+		// the truncated steps may miss the previous target slightly, which would keep unity gain from being exact
+		gain = block_target;
+		int32_t target = volume;
+		if (is_fading()) {
+			fade_position = fade_length - fade_position > GAIN_BLOCK_SAMPLES ? fade_position + GAIN_BLOCK_SAMPLES : fade_length;
+			auto const progress = static_cast<int32_t>(static_cast<uint64_t>(fade_position) * UNITY_GAIN / fade_length);
+			target = (fade_curve_gain(fade_curve, progress) * volume) >> 15;
+		}
+		// gain is Q15 with 16 more fractional bits, so that even slow ramps move by a nonzero step
+		block_target = static_cast<uint32_t>(target) << 16;
+		gain_step = static_cast<int32_t>((static_cast<int64_t>(block_target) - gain) / static_cast<int64_t>(GAIN_BLOCK_SAMPLES));
+		block_remaining = GAIN_BLOCK_SAMPLES;
+	}
+
+	int32_t volume { UNITY_GAIN };
+	// unity is 2^31, which still fits
+	uint32_t gain { static_cast<uint32_t>(UNITY_GAIN) << 16 };
+	uint32_t block_target { static_cast<uint32_t>(UNITY_GAIN) << 16 };
+	int32_t gain_step { 0 };
+	uint32_t block_remaining { 0 };
+
+	uint32_t sample_rate { 44100 };
+	FadeCurve fade_curve { FadeCurve::Linear };
+	uint32_t fade_length { 0 };
+	uint32_t fade_position { 0 };
+};
@@ -10,7 +10,6 @@
 #include "Settings.h"
 #include "SettingsMenu.h"
 #include "TimeFormatMenu.h"
-#include "VideoPlayer.h"
 #include "string_constants.h"
 #include <limits>
 #include <memory>
@@ -117,7 +116,7 @@ Menu* create_menu_structure()
 		MenuEntry { main_menu_files, std::move(file_menu_object) },
 		MenuEntry { main_menu_settings, std::move(settings_menu_object) },
 		MenuEntry { main_menu_diagnostics, std::make_unique<DiagnosticMenu>() },
-		MenuEntry { main_menu_video, std::make_unique<VideoPlayer>() },
+		MenuEntry { main_menu_video, std::make_unique<FileSelectMenu>(FileMenuState::None) },
 	};
 	static OptionsMenu* main_menu = new OptionsMenu(all_menus);
 
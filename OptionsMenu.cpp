@@ -201,22 +201,23 @@ Menu* ClockFaceSelectMenu::draw_menu(Display* display, uint16_t delta_millis)
 		auto clockFace = this->clock_faces[this->current_menu];
 
 		ace_time::ZonedDateTime curtime = TimeManager::the().current_time();
+		YieldBudget budget { YieldSubsystem::ClockFaces };
 		display->firstPage();
 		do {
 			display->setMaxClipWindow();
 			display->setClipWindow(0, 0, display->getDisplayWidth() / 2, display->getDisplayHeight());
 			perform_menu_draw(display, display->getDisplayWidth() / 2, display->getDisplayHeight());
 
-			yield();
+			budget.check();
 			display->setDrawColor(1);
 			display->setMaxClipWindow();
 			display->setClipWindow(display->getDisplayWidth() / 2, 0,
 				display->getDisplayWidth(),
 				display->getDisplayHeight());
 			clockFace(display, &curtime, 0.0, display->getDisplayWidth() / 2, 0,
-				display->getDisplayWidth() / 2, display->getDisplayHeight());
+				display->getDisplayWidth() / 2, display->getDisplayHeight(), budget);
 
-			yield();
+			budget.check();
 		} while (display->nextPage());
 		display->setMaxClipWindow();
 	} else {
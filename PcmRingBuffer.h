@@ -0,0 +1,74 @@
+/** Lock-free single-producer/single-consumer ring buffer of PCM samples. */
+
+#pragma once
+
+#include "Span.h"
+#include <array>
+#include <atomic>
+#include <stdint.h>
+
+// Holds up to capacity stereo samples, each packed into a word as the I2S peripheral takes them (right channel in the upper half).
+// One side may push while the other pops, e.g. the main loop and an interrupt, without locks: each side only writes its own index,
+// and publishes it with release ordering after the samples are in place. The indices run freely and wrap around at 2^32,
+// which the power-of-two capacity divides.
+// All functions are always inlined, so that interrupt handlers in IRAM don't call into flash.
+template <uint32_t capacity>
+class PcmRingBuffer {
+	static_assert(capacity > 0 && (capacity & (capacity - 1)) == 0, "capacity must be a power of two");
+
+public:
+	// Producer side. Returns false if the buffer is full.
+	ALWAYS_INLINE bool push(uint32_t sample)
+	{
+		auto const write_index = write.load(std::memory_order_relaxed);
+		if (write_index - read.load(std::memory_order_acquire) == capacity)
+			return false;
+		samples[write_index % capacity] = sample;
+		write.store(write_index + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Consumer side. Returns false if the buffer is empty; the sample stays in the buffer until it's dropped.
+	ALWAYS_INLINE bool peek(uint32_t& sample) const
+	{
+		auto const read_index = read.load(std::memory_order_relaxed);
+		if (write.load(std::memory_order_acquire) == read_index)
+			return false;
+		sample = samples[read_index % capacity];
+		return true;
+	}
+
+	// Consumer side. Removes the oldest sample; only valid after a successful peek.
+	ALWAYS_INLINE void drop()
+	{
+		read.store(read.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+	ALWAYS_INLINE bool pop(uint32_t& sample)
+	{
+		if (!peek(sample))
+			return false;
+		drop();
+		return true;
+	}
+
+	// Consumer side, or either side while the other one is stopped.
+	ALWAYS_INLINE void clear() { read.store(write.load(std::memory_order_acquire), std::memory_order_release); }
+
+	// Exact on either side while the other side is idle; otherwise a snapshot that may be outdated by the time it's used.
+	ALWAYS_INLINE uint32_t size() const
+	{
+		// reading the read index first keeps the difference from going negative, and the limit covers pops in between
+		auto const read_index = read.load(std::memory_order_acquire);
+		auto const count = write.load(std::memory_order_acquire) - read_index;
+		return count < capacity ? count : capacity;
+	}
+	ALWAYS_INLINE uint32_t free_space() const { return capacity - size(); }
+	static constexpr uint32_t max_size() { return capacity; }
+
+private:
+	std::array<uint32_t, capacity> samples {};
+	// number of samples ever pushed and popped
+	std::atomic<uint32_t> write { 0 };
+	std::atomic<uint32_t> read { 0 };
+};
@@ -0,0 +1,92 @@
+#include "PcmRingOutput.h"
+#include <ets_sys.h>
+
+PcmRingOutput* PcmRingOutput::playing_output = nullptr;
+
+// SLC DMA descriptor as the hardware reads it (slc_queue_item_t in core_esp8266_i2s.cpp). The core links them into a ring.
+struct SlcDescriptor {
+	uint32_t block_size : 12;
+	uint32_t data_length : 12;
+	uint32_t unused : 5;
+	uint32_t sub_sof : 1;
+	uint32_t eof : 1;
+	volatile uint32_t owner : 1;
+	uint32_t* buffer;
+	SlcDescriptor* next;
+};
+
+PcmRingOutput::~PcmRingOutput()
+{
+	if (playing_output == this)
+		stop();
+}
+
+bool PcmRingOutput::begin()
+{
+	ring.clear();
+	the_starved_buffers = 0;
+	silent_buffers = 0;
+	if (!AudioOutputI2S::begin())
+		return false;
+	playing_output = this;
+	// the core's I2S setup has attached its own handler and enabled the end-of-buffer interrupt
+	ETS_SLC_INTR_DISABLE();
+	ETS_SLC_INTR_ATTACH(&PcmRingOutput::refill_dma_buffer, nullptr);
+	ETS_SLC_INTR_ENABLE();
+	return true;
+}
+
+bool PcmRingOutput::ConsumeSample(int16_t sample[2])
+{
+	// same conversion as AudioOutputI2S for external DACs, but into the ring buffer instead of the DMA buffers
+	int16_t stereo_sample[2] = { sample[LEFTCHANNEL], sample[RIGHTCHANNEL] };
+	MakeSampleStereo16(stereo_sample);
+	if (mono) {
+		auto const mixed = (static_cast<int32_t>(stereo_sample[LEFTCHANNEL]) + stereo_sample[RIGHTCHANNEL]) / 2;
+		stereo_sample[LEFTCHANNEL] = stereo_sample[RIGHTCHANNEL] = static_cast<int16_t>(mixed);
+	}
+	auto const left = static_cast<uint16_t>(Amplify(stereo_sample[LEFTCHANNEL]));
+	auto const right = static_cast<uint16_t>(Amplify(stereo_sample[RIGHTCHANNEL]));
+	return ring.push(static_cast<uint32_t>(right) << 16 | left);
+}
+
+bool PcmRingOutput::stop()
+{
+	// the handler plays silence from here on, until the core's I2S shutdown disables the interrupt
+	if (playing_output == this)
+		playing_output = nullptr;
+	ring.clear();
+	return AudioOutputI2S::stop();
+}
+
+void IRAM_ATTR PcmRingOutput::refill_dma_buffer(void*)
+{
+	auto const status = SLCIS;
+	SLCIC = 0xFFFFFFFF;
+	if ((status & SLCIRXEOF) == 0)
+		return;
+
+	// The DMA engine has just played this buffer and gets back to it after the others, so it's refilled right away.
+	auto const* played = reinterpret_cast<SlcDescriptor const*>(SLCRXEDA);
+	uint32_t const length = played->data_length / sizeof(uint32_t);
+	uint32_t filled = 0;
+	auto* output = playing_output;
+	if (output) {
+		while (filled < length && output->ring.pop(played->buffer[filled]))
+			++filled;
+	}
+	// silence instead of repeating the old samples
+	for (auto i = filled; i < length; ++i)
+		played->buffer[i] = 0;
+
+	if (!output)
+		return;
+	if (filled < length)
+		output->the_starved_buffers = output->the_starved_buffers + 1;
+	if (filled == 0) {
+		if (output->silent_buffers < I2S_DMA_BUFFER_COUNT)
+			output->silent_buffers = output->silent_buffers + 1;
+	} else {
+		output->silent_buffers = 0;
+	}
+}
@@ -0,0 +1,52 @@
+/*
+ * I2S output whose DMA buffers are refilled from an interrupt, so that audio keeps playing while the main loop is busy.
+ */
+
+#pragma once
+
+#include "PcmRingBuffer.h"
+#include <AudioOutputI2S.h>
+
+// The ESP8266 core's I2S driver has a fixed number of DMA buffers of a fixed size (SLC_BUF_CNT and SLC_BUF_LEN in core_esp8266_i2s.cpp).
+constexpr uint32_t I2S_DMA_BUFFER_COUNT = 8;
+constexpr uint32_t I2S_DMA_BUFFER_SAMPLES = 64;
+// Decoded samples that wait for the DMA buffers; 23ms at 44.1kHz.
+constexpr uint32_t PCM_RING_CAPACITY = 1024;
+
+// The decoder writes into a ring buffer from the main loop, and the interrupt that the DMA engine raises after playing a
+// buffer refills that buffer from the ring. A slow SD read or display flush thus only drains the ring buffer instead of
+// starving the DMA buffers.
+// The interrupt handler and everything it touches are in IRAM or DRAM, so it keeps running while flash is written and the
+// flash cache is off (e.g. EEPROM commits, WiFi configuration, OTA updates). This replaces the core's handler, which only
+// queues the played buffers for i2s_write_sample; those functions run from flash and must not be used while playing.
+// Only one instance can be playing at a time, since the interrupt has no context.
+class PcmRingOutput : public AudioOutputI2S {
+public:
+	using AudioOutputI2S::AudioOutputI2S;
+	virtual ~PcmRingOutput() override;
+
+	virtual bool begin() override;
+	// Returns false if the ring buffer is full.
+	virtual bool ConsumeSample(int16_t sample[2]) override;
+	// Drops the samples that haven't been played yet. At the end of a track, AudioManager waits for them to drain first.
+	virtual bool stop() override;
+
+	uint32_t queued_samples() const { return ring.size(); }
+	uint32_t free_samples() const { return ring.free_space(); }
+	// Whether the last played DMA buffer was refilled without any samples, i.e. the output has run dry and plays silence.
+	bool is_starved() const { return silent_buffers > 0; }
+	// Whether all queued samples have been played, including those in the DMA buffers.
+	bool is_played_out() const { return ring.size() == 0 && silent_buffers >= I2S_DMA_BUFFER_COUNT; }
+	// DMA buffers that the ring buffer couldn't fill completely
+	uint32_t starved_buffers() const { return the_starved_buffers; }
+
+private:
+	static void IRAM_ATTR refill_dma_buffer(void*);
+
+	static PcmRingOutput* playing_output;
+
+	PcmRingBuffer<PCM_RING_CAPACITY> ring;
+	volatile uint32_t the_starved_buffers { 0 };
+	// DMA buffers refilled in a row without any samples
+	volatile uint32_t silent_buffers { 0 };
+};
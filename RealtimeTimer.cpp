@@ -1,34 +1,33 @@
 #include "RealtimeTimer.h"
 #include "Arduino.h"
+#include <algorithm>
 
 void RealtimeTimer::attach(timercallback callback, uint64_t interval_microseconds)
 {
-	constexpr double div1_max_microseconds = (1 << 23) / 80.;
-	constexpr double div16_max_microseconds = (1 << 23) / 5.;
-	constexpr double div256_max_microseconds = ((1 << 23) / 80.) * 256.;
+	// timer1 counts down from at most 2^23 - 1 ticks of the 80 MHz APB clock (independent of the CPU clock), divided by 1, 16 or 256
+	constexpr uint64_t max_ticks = (1 << 23) - 1;
 
 	TIM_DIV_ENUM divider;
-	uint32_t ticks;
-	if (interval_microseconds < div16_max_microseconds) {
-		divider = TIM_DIV16;
-		ticks = interval_microseconds * 5;
-	} else if (interval_microseconds < div1_max_microseconds) {
+	uint64_t ticks;
+	if (interval_microseconds * 80 <= max_ticks) {
 		divider = TIM_DIV1;
 		ticks = interval_microseconds * 80;
-	} else if (interval_microseconds < div256_max_microseconds) {
-		divider = TIM_DIV256;
-		ticks = (interval_microseconds * 80) / 256;
+	} else if (interval_microseconds * 5 <= max_ticks) {
+		divider = TIM_DIV16;
+		ticks = interval_microseconds * 5;
 	} else {
 		divider = TIM_DIV256;
-		ticks = 0xffffffff;
+		ticks = std::min((interval_microseconds * 80) / 256, max_ticks);
 	}
 
+	timer1_disable();
 	timer1_attachInterrupt(callback);
 	timer1_enable(divider, TIM_EDGE, TIM_LOOP);
-	timer1_write(ticks);
+	timer1_write(static_cast<uint32_t>(ticks));
 }
 
 void RealtimeTimer::detach()
 {
+	timer1_disable();
 	timer1_detachInterrupt();
 }
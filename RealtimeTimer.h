@@ -4,8 +4,8 @@
 	- Ticker uses the OS timer feature, which is just using the cooperative multitasking via yield(). Not realtime capable.
 	- Various libraries use timer 0 for some fucking reason, which disables the RTOS functionality and will get you killed by the watchdog.
 
-	Note: This thing is horribly broken, even though it technically should work and WiFi shouldn't be using timer 1.
-	I have no idea what's going on and give up for now.
+	The callback runs in interrupt context on every tick, so it has to be IRAM_ATTR (along with everything it calls)
+	and short, and must not yield, allocate or touch the SD card. This rules out running the audio decoder from here.
 */
 class RealtimeTimer {
 public:
@@ -1,17 +1,18 @@
 #include "SRLV.h"
+#include "YieldBudget.h"
+#include <array>
 
 #ifndef pgm_read_byte
 #define pgm_read_byte(x) (*(x))
 #endif
-#ifndef yield
-#define yield()
+#ifndef PROGMEM
+#define PROGMEM
 #endif
 
 namespace SRLV {
 
 constexpr uint8_t full_byte_marker = 0x80;
 constexpr uint8_t rle_length_limit = 0x7f;
-constexpr uint8_t row_size = 80 / 8;
 
 enum class CompressionMode : uint8_t {
 	Nibble = 0,
@@ -20,49 +21,153 @@ enum class CompressionMode : uint8_t {
 	Pokemon = 3,
 	PokemonDelta = 4,
 	PokemonSnake = 5,
+	Turtle = 6,
 };
 
-static std::vector<uint8_t> decompress_nibble(Span<uint8_t> data, size_t pixel_count)
+// Bit-reversed bytes, which mirror 8 pixels horizontally.
+static constexpr std::array<uint8_t, 256> make_bit_reverse_table()
 {
-	// 0 = black, 1 = white (as usual with XBM)
-	uint8_t current_color = 0;
-	// bit position within the byte that is going to be written next
-	uint8_t current_bit = 1;
-	uint8_t current_byte = 0;
-	std::vector<uint8_t> output;
-	auto byte_count = pixel_count / 8 + 1;
-	output.reserve(byte_count);
-
-	auto next_pixel = [&] {
-		current_bit <<= 1;
-		// bit was shifted out, restart the next byte
-		if (current_bit == 0) {
-			output.push_back(current_byte);
-			current_byte = 0;
-			current_bit = 1;
+	std::array<uint8_t, 256> table {};
+	for (size_t byte = 0; byte < table.size(); ++byte) {
+		uint8_t reversed = 0;
+		for (auto bit = 0; bit <= 7; ++bit)
+			reversed |= ((byte >> bit) & 1) << (7 - bit);
+		table[byte] = reversed;
+	}
+	return table;
+}
+
+static constexpr std::array<uint8_t, 256> bit_reverse_table PROGMEM = make_bit_reverse_table();
+
+// BitWriter store that XORs every finished word and byte with the previous frame's data at the same position,
+// which avoids a separate pass over the frame.
+class DeltaStore {
+public:
+	DeltaStore(Span<uint8_t> output, Span<uint8_t const> previous_frame)
+		: output_start(output.data())
+		, previous(previous_frame.data())
+	{
+	}
+
+	ALWAYS_INLINE void store_word(uint8_t* destination, uint32_t word)
+	{
+		::store_word(destination, word ^ load_word(previous + (destination - output_start)));
+	}
+
+	ALWAYS_INLINE void store_byte(uint8_t* destination, uint8_t byte)
+	{
+		*destination = byte ^ previous[destination - output_start];
+	}
+
+	void store_fill(uint8_t* destination, uint32_t fill, size_t word_count)
+	{
+		for (; word_count > 0; --word_count, destination += sizeof(uint32_t))
+			store_word(destination, fill);
+	}
+
+private:
+	uint8_t const* output_start;
+	uint8_t const* previous;
+};
+
+// BitWriter store that writes every second row back to front with bit-reversed bytes, so that snake frames come out in normal order.
+// Relies on the writer storing every byte once and in order to keep track of the current row.
+class SnakeStore {
+public:
+	// The output starts at the beginning of a row; the first row is reversed if first_row_reversed is set.
+	SnakeStore(Span<uint8_t> output, size_t row_size, bool first_row_reversed)
+		: row_start(output.data())
+		, row_end(output.data() + row_size)
+		, is_row_reversed(first_row_reversed)
+	{
+	}
+
+	ALWAYS_INLINE void store_word(uint8_t* destination, uint32_t word)
+	{
+		if (destination + sizeof(uint32_t) > row_end) {
+			// rows don't have to be a multiple of 4 bytes long
+			for (size_t i = 0; i < sizeof(uint32_t); ++i)
+				store_byte(destination + i, static_cast<uint8_t>(word >> (8 * i)));
+			return;
 		}
-	};
+		auto* target = destination;
+		if (is_row_reversed) {
+			// mirroring the whole word reverses its byte order, and each byte's bits; fills look the same in both directions
+			if (word != 0 && word != ~0u)
+				word = reverse_byte(word >> 24) | reverse_byte(word >> 16) << 8 | reverse_byte(word >> 8) << 16 | reverse_byte(word) << 24;
+			target = row_end - (destination - row_start) - sizeof(uint32_t);
+		}
+		::store_word(target, word);
+		if (destination + sizeof(uint32_t) == row_end)
+			next_row();
+	}
 
-	auto handle_byte = [&](uint8_t input_byte) {
-		size_t i = 0;
-		for (i = 0; i < input_byte; ++i) {
-			yield();
-			// optimization: write entire bytes as long as possible
-			if (current_bit == 1 && i + 8 <= input_byte) {
-				i += 7;
-				output.push_back(current_color == 1 ? 0xff : 0);
-				continue;
-			}
-			if (current_color == 1)
-				current_byte |= current_bit;
-			next_pixel();
+	ALWAYS_INLINE void store_byte(uint8_t* destination, uint8_t byte)
+	{
+		if (is_row_reversed)
+			*(row_end - 1 - (destination - row_start)) = reverse_byte(byte);
+		else
+			*destination = byte;
+		if (destination + 1 == row_end)
+			next_row();
+	}
+
+	void store_fill(uint8_t* destination, uint32_t fill, size_t word_count)
+	{
+		// fills look the same in both directions, so reversed rows only need the mirrored range
+		auto count = word_count * sizeof(uint32_t);
+		while (count > 0) {
+			auto const row_left = static_cast<size_t>(row_end - destination);
+			auto const length = count < row_left ? count : row_left;
+			auto* const start = is_row_reversed ? row_end - (destination - row_start) - length : destination;
+			__builtin_memset(start, static_cast<uint8_t>(fill), length);
+			destination += length;
+			count -= length;
+			if (destination == row_end)
+				next_row();
 		}
+	}
+
+private:
+	static ALWAYS_INLINE uint32_t reverse_byte(uint32_t byte) { return pgm_read_byte(&bit_reverse_table[byte & 0xff]); }
+
+	void next_row()
+	{
+		auto const row_size = row_end - row_start;
+		row_start = row_end;
+		row_end += row_size;
+		is_row_reversed = !is_row_reversed;
+	}
+
+	uint8_t* row_start;
+	uint8_t* row_end;
+	bool is_row_reversed;
+};
+
+// Pixel writers for frames in XBM bit order.
+// Unchecked writers don't drop data past the end of the frame, which is only safe for frames that passed validate_frame.
+template <bool is_checked = true>
+using FrameWriter = BitWriter<BitOrder::LsbFirst, DirectBitStore, is_checked>;
+template <bool is_checked = true>
+using DeltaFrameWriter = BitWriter<BitOrder::LsbFirst, DeltaStore, is_checked>;
+template <bool is_checked = true>
+using SnakeFrameWriter = BitWriter<BitOrder::LsbFirst, SnakeStore, is_checked>;
+
+template <typename Writer>
+static void decompress_nibble(Writer writer, Span<uint8_t const> data, YieldBudget& budget)
+{
+	// 0 = black, 1 = white (as usual with XBM)
+	uint8_t current_color = 0;
+
+	auto handle_byte = [&](uint8_t run_length) {
+		writer.write_run(current_color, run_length);
 		current_color = 1 - current_color;
 	};
 
-	for (size_t i = 0; i < data.size(); ++i) {
-		yield();
-		auto input_byte = pgm_read_byte(data.offset_pointer(i));
+	ProgmemReader reader { data };
+	while (!reader.is_at_end()) {
+		budget.check();
+		auto input_byte = reader.read_byte();
 
 		if ((input_byte & full_byte_marker) > 0) {
 			handle_byte(input_byte & rle_length_limit);
@@ -73,141 +178,611 @@ static std::vector<uint8_t> decompress_nibble(Span<uint8_t> data, size_t pixel_c
 	}
 
 	// continue with the last color until the end
-	current_color = 1 - current_color;
-	while (current_bit != 1) {
-		if (current_color == 1)
-			current_byte |= current_bit;
-		next_pixel();
-	}
-
-	output.resize(byte_count, current_color == 1 ? 0xff : 0);
-	return output;
+	writer.fill_to_end(1 - current_color);
 }
 
-static std::vector<uint8_t> decompress_pokemon(Span<uint8_t> data, size_t pixel_count)
+// Prefix XOR of the bits in a byte, in LSB-to-MSB order. Bit n of the result is the XOR of the bits 0 to n of the input.
+// This integrates a byte of pixel deltas into pixels, assuming that the pixel before the byte was black.
+static constexpr std::array<uint8_t, 256> make_prefix_xor_table()
 {
-	uint8_t current_bit = 1;
-	uint8_t current_byte = 0;
-	std::vector<uint8_t> output;
-	auto byte_count = pixel_count / 8 + 1;
-	output.reserve(byte_count);
-
-	auto next_pixel = [&] {
-		current_bit <<= 1;
-		// bit was shifted out, restart the next byte
-		if (current_bit == 0) {
-			output.push_back(current_byte);
-			current_byte = 0;
-			current_bit = 1;
+	std::array<uint8_t, 256> table {};
+	for (size_t byte = 0; byte < table.size(); ++byte) {
+		uint8_t pixel = 0;
+		uint8_t pixels = 0;
+		for (auto bit = 0; bit <= 7; ++bit) {
+			pixel ^= (byte >> bit) & 1;
+			pixels |= pixel << bit;
 		}
-	};
+		table[byte] = pixels;
+	}
+	return table;
+}
+
+static constexpr std::array<uint8_t, 256> prefix_xor_table PROGMEM = make_prefix_xor_table();
 
-	for (size_t byte_index = 0; byte_index < data.size(); ++byte_index) {
-		uint8_t byte = pgm_read_byte(data.offset_pointer(byte_index));
-		yield();
+template <typename Writer>
+static void decompress_pokemon(Writer writer, Span<uint8_t const> data, YieldBudget& budget)
+{
+	// The pixel deltas are integrated while expanding them, so the writer receives final pixels.
+	// A run of zero deltas continues the color of the last pixel, and raw deltas are integrated via lookup table.
+	uint8_t last_pixel = 0;
+
+	ProgmemReader reader { data };
+	while (!reader.is_at_end()) {
+		uint8_t byte = reader.read_byte();
+		budget.check();
 		uint8_t data = byte & rle_length_limit;
 		if ((byte & full_byte_marker) > 0) {
 			uint8_t run_length = data + 7;
-			uint8_t i = 0;
-			for (; (current_bit != 1) && i < run_length; ++i)
-				next_pixel();
-			for (; i + 8 < run_length; i += 8)
-				output.push_back(0);
-			for (; i < run_length; ++i)
-				next_pixel();
+			writer.write_run(last_pixel, run_length);
 		} else {
-			for (uint8_t i = 0; i < 7; ++i) {
-				// shift in remaining bits directly
-				if (current_bit == 1) {
-					current_byte = data >> i;
-					current_bit = 1 << (7 - i);
+			uint8_t pixels = pgm_read_byte(&prefix_xor_table[data]);
+			if (last_pixel == 1)
+				pixels = ~pixels;
+			writer.write_bits(pixels, 7);
+			last_pixel = (pixels >> 6) & 1;
+		}
+	}
+
+	// missing deltas are black, so the last pixel's color continues until the end
+	writer.fill_to_end(last_pixel);
+}
+
+// Turtle data is read MSB-first, which is the order that the encoder's BitStream writes it in.
+// Reading past the end yields zero bits; callers check bits_left() where that matters.
+using TurtleBitReader = BitReader<BitOrder::MsbFirst>;
+
+// Rice-Golomb code with order k: unary-coded quotient (zeros terminated by a one), followed by k remainder bits.
+// Returns false if the data ends before the code does.
+static bool read_rice(TurtleBitReader& reader, uint8_t k, uint16_t& value)
+{
+	uint16_t quotient = 0;
+	while (true) {
+		if (reader.bits_left() < 1u + k)
+			return false;
+		if (reader.read_bits(1) == 1)
+			break;
+		++quotient;
+	}
+	value = (quotient << k) | reader.read_bits(k);
+	return true;
+}
+
+enum class TurtleCommand : uint8_t {
+	Left135 = 0,
+	Left90 = 1,
+	Left45 = 2,
+	Forward1 = 3,
+	ForwardN = 4,
+	ForwardMany = 5,
+	Right45 = 6,
+	Right90 = 7,
+	Right135 = 8,
+};
+constexpr uint8_t turtle_command_count = 9;
+// info byte and one Huffman table entry per command
+constexpr size_t turtle_header_size = 1 + turtle_command_count;
+constexpr uint8_t turtle_inverted_flag = 0x80;
+constexpr uint8_t turtle_max_code_length = 5;
+constexpr uint8_t turtle_unused_table_entry = 0xff;
+constexpr uint8_t turtle_single_pixel_trailer_marker = 0x80;
+// Turtle objects are first drawn into this buffer, which is too large for the ESP8266's 4 KiB stack.
+// It's shared by all frame sizes, so it holds the largest one that the decoders are instantiated for.
+// Between objects and frames, it's all zeros.
+constexpr size_t turtle_object_buffer_size = frame_size<128, 64>;
+alignas(uint32_t) static uint8_t turtle_object_buffer[turtle_object_buffer_size] {};
+
+// Directions are clockwise in steps of 45 degrees, starting at positive X (right). Y points down.
+constexpr int8_t direction_x[8] = { 1, 1, 0, -1, -1, -1, 0, 1 };
+constexpr int8_t direction_y[8] = { 0, 1, 1, 1, 0, -1, -1, -1 };
+// Direction change of each command, in 45 degree steps.
+constexpr uint8_t turtle_direction_delta[turtle_command_count] = { 5, 6, 7, 0, 0, 0, 1, 2, 3 };
+
+// Huffman decoding via a lookup table indexed with the next turtle_max_code_length bits.
+// Each entry holds the code length in the upper nibble and the command in the lower nibble; 0 marks invalid codes.
+class TurtleCommandTable {
+public:
+	explicit TurtleCommandTable(Span<uint8_t const> table_data)
+	{
+		ProgmemReader reader { table_data };
+		for (uint8_t command = 0; command < turtle_command_count; ++command) {
+			auto const entry = reader.read_byte();
+			if (entry == turtle_unused_table_entry)
+				continue;
+			uint8_t const length = (entry >> 5) + 1;
+			if (length > turtle_max_code_length)
+				continue;
+			uint8_t const code = entry & ((1 << length) - 1);
+			uint8_t const first = code << (turtle_max_code_length - length);
+			uint8_t const last = (code + 1) << (turtle_max_code_length - length);
+			for (auto i = first; i < last; ++i)
+				lookup[i] = (length << 4) | command;
+		}
+	}
+
+	// Returns false on an invalid code or at the end of data.
+	bool read_command(TurtleBitReader& reader, TurtleCommand& command) const
+	{
+		if (reader.bits_left() == 0)
+			return false;
+		auto const entry = lookup[reader.peek_bits(turtle_max_code_length)];
+		uint8_t const length = entry >> 4;
+		if (length == 0 || length > reader.bits_left())
+			return false;
+		reader.skip_bits(length);
+		command = static_cast<TurtleCommand>(entry & 0xf);
+		return true;
+	}
+
+private:
+	std::array<uint8_t, 1 << turtle_max_code_length> lookup {};
+};
+
+// Walks the edge of a turtle object, calling step(from_x, from_y, to_x, to_y) for each single-pixel step.
+// Returns false if the object is malformed.
+template <size_t width, size_t height, typename StepCallback>
+static bool walk_turtle_object(TurtleBitReader& reader, TurtleCommandTable const& table, uint8_t start_x, uint8_t start_y, StepCallback step)
+{
+	uint8_t direction = 1;
+	int16_t x = start_x;
+	int16_t y = start_y;
+	// an edge can't contain more steps than pixels, since the turtle never moves over a pixel twice
+	size_t remaining_steps = width * height;
+
+	auto take_step = [&] {
+		int16_t const next_x = x + direction_x[direction];
+		int16_t const next_y = y + direction_y[direction];
+		if (next_x < 0 || next_y < 0 || next_x >= static_cast<int16_t>(width) || next_y >= static_cast<int16_t>(height) || remaining_steps == 0)
+			return false;
+		step(x, y, next_x, next_y);
+		x = next_x;
+		y = next_y;
+		--remaining_steps;
+		return true;
+	};
+
+	do {
+		TurtleCommand command;
+		if (!table.read_command(reader, command))
+			return false;
+		direction = (direction + turtle_direction_delta[static_cast<uint8_t>(command)]) % 8;
+
+		if (command == TurtleCommand::ForwardMany) {
+			// move until the start or the image border is reached
+			do {
+				if (!take_step())
 					break;
-				}
-				uint8_t pixel_value = data & (1 << i);
-				if (pixel_value > 0)
-					current_byte |= current_bit;
-				next_pixel();
+			} while (x != start_x || y != start_y);
+			continue;
+		}
+
+		uint16_t distance = 1;
+		if (command == TurtleCommand::ForwardN) {
+			if (!read_rice(reader, 2, distance))
+				return false;
+			distance += 1;
+		}
+		for (; distance > 0; --distance) {
+			if (!take_step())
+				return false;
+		}
+	} while (x != start_x || y != start_y);
+
+	return true;
+}
+
+template <size_t width, size_t height>
+static void decompress_turtle(Span<uint8_t> output, Span<uint8_t const> data, YieldBudget& budget)
+{
+	constexpr size_t row_size = width / 8;
+	output = output.slice(0, frame_size<width, height>);
+	__builtin_memset(output.data(), 0, output.size());
+	if (data.size() < turtle_header_size)
+		return;
+
+	auto const info = pgm_read_byte(data.offset_pointer(0));
+	TurtleCommandTable const table { data.slice(1, turtle_command_count) };
+	TurtleBitReader reader { data.slice(turtle_header_size) };
+
+	auto toggle_pixel = [&](Span<uint8_t> image, int16_t x, int16_t y) {
+		image[y * row_size + x / 8] ^= 1 << (x % 8);
+	};
+
+	// Objects are first drawn here and then XORed onto the frame, since their edge and fill may overlap.
+	static_assert(frame_size<width, height> <= turtle_object_buffer_size, "Turtle object buffer is too small");
+	Span<uint8_t> object_pixels { turtle_object_buffer, frame_size<width, height> };
+
+	bool has_trailer = false;
+	while (reader.bits_left() >= 16) {
+		budget.check();
+		uint8_t const start_x = reader.read_bits(8);
+		if (start_x == turtle_single_pixel_trailer_marker) {
+			has_trailer = true;
+			break;
+		}
+		uint8_t const start_y = reader.read_bits(8);
+		if (start_x >= width || start_y >= height)
+			break;
+
+		// Even-odd fill with edge flags: every edge step that crosses a scanline toggles a flag at the crossing,
+		// then each row is filled from every odd flag up to and including the next even flag.
+		auto const object_start = reader;
+		int16_t min_y = start_y;
+		int16_t max_y = start_y;
+		auto const is_valid = walk_turtle_object<width, height>(reader, table, start_x, start_y, [&](int16_t from_x, int16_t from_y, int16_t to_x, int16_t to_y) {
+			if (to_y > from_y)
+				toggle_pixel(object_pixels, from_x, from_y);
+			else if (to_y < from_y)
+				toggle_pixel(object_pixels, to_x, to_y);
+			if (to_y < min_y)
+				min_y = to_y;
+			if (to_y > max_y)
+				max_y = to_y;
+		});
+		if (!is_valid) {
+			object_pixels.fill(0);
+			break;
+		}
+
+		size_t const first_byte = min_y * row_size;
+		size_t const end_byte = (max_y + 1) * row_size;
+		for (size_t row_start = first_byte; row_start < end_byte; row_start += row_size) {
+			uint8_t inside = 0;
+			for (size_t i = row_start; i < row_start + row_size; ++i) {
+				auto const flags = object_pixels[i];
+				uint8_t fill = pgm_read_byte(&prefix_xor_table[flags]);
+				if (inside)
+					fill = ~fill;
+				inside = fill >> 7;
+				object_pixels[i] = fill | flags;
 			}
 		}
-	}
 
-	while (current_bit != 1)
-		next_pixel();
+		// The fill doesn't necessarily include the edge (e.g. horizontal edges on the bottom), so draw it again.
+		reader = object_start;
+		object_pixels[start_y * row_size + start_x / 8] |= 1 << (start_x % 8);
+		walk_turtle_object<width, height>(reader, table, start_x, start_y, [&](int16_t, int16_t, int16_t to_x, int16_t to_y) {
+			object_pixels[to_y * row_size + to_x / 8] |= 1 << (to_x % 8);
+		});
+		reader.align_to_byte_boundary();
 
-	output.resize(byte_count, 0);
+		for (size_t i = first_byte; i < end_byte; ++i) {
+			output[i] ^= object_pixels[i];
+			object_pixels[i] = 0;
+		}
+	}
 
-	uint8_t previous_pixel = 0;
-	for (size_t i = 0; i < output.size(); ++i) {
-		uint8_t byte = output[i];
-		uint8_t new_byte = 0;
-		for (auto bit = 0; bit <= 7; ++bit) {
-			uint8_t delta = (byte & (1 << bit)) > 0;
-			uint8_t pixel_value = delta ^ previous_pixel;
-			previous_pixel = pixel_value;
-			new_byte |= (pixel_value << bit);
+	if (has_trailer && reader.bits_left() >= 16) {
+		// single pixels, each coded as zig-zag coded difference from the previous one (0 -> 1, -1 -> 2, 1 -> 3, ...)
+		int16_t x = reader.read_bits(8);
+		int16_t y = reader.read_bits(8);
+		auto unzigzag = [](uint16_t value) -> int16_t { return (value & 1) ? (value - 1) / 2 : -static_cast<int16_t>(value / 2); };
+		while (true) {
+			if (x >= 0 && y >= 0 && x < static_cast<int16_t>(width) && y < static_cast<int16_t>(height))
+				toggle_pixel(output, x, y);
+			uint16_t delta_x, delta_y;
+			if (!read_rice(reader, 5, delta_x) || !read_rice(reader, 5, delta_y))
+				break;
+			x -= unzigzag(delta_x);
+			y -= unzigzag(delta_y);
 		}
-		output[i] = new_byte;
 	}
 
-	return output;
+	if ((info & turtle_inverted_flag) > 0) {
+		for (auto& byte : output)
+			byte = ~byte;
+	}
 }
 
-static void decompress_delta(Span<uint8_t> current, Span<uint8_t> previous)
+bool validate_frame(Span<uint8_t const> data, size_t pixel_count)
 {
-	for (size_t i = 0; i < current.size(); ++i) {
-		current[i] ^= previous[i];
+	if (data.is_empty())
+		return false;
+	auto const mode = static_cast<CompressionMode>(pgm_read_byte(data.data()));
+	// the Turtle decoder checks all coordinates anyway
+	if (mode == CompressionMode::Turtle)
+		return true;
+	if (mode > CompressionMode::Turtle)
+		return false;
+
+	auto const is_nibble = mode == CompressionMode::Nibble || mode == CompressionMode::NibbleDelta || mode == CompressionMode::NibbleSnake;
+	size_t total_length = 0;
+	ProgmemReader reader { data.slice(1) };
+	while (!reader.is_at_end()) {
+		auto const byte = reader.read_byte();
+		if ((byte & full_byte_marker) > 0)
+			total_length += (byte & rle_length_limit) + (is_nibble ? 0 : 7);
+		else
+			total_length += is_nibble ? (byte >> 4) + (byte & 0xf) : 7;
 	}
+	// Pokémon frames end with up to 6 pixels past the end of the frame if the pixel count isn't a multiple of 7.
+	// Writers never store these, since they don't complete a byte.
+	return total_length < pixel_count + 8;
 }
 
-constexpr uint8_t bitswap(uint8_t x)
+template <size_t width, size_t height, bool is_checked>
+static void decompress_frame(Span<uint8_t> output, Span<uint8_t const> data, Span<uint8_t const> previous_frame)
 {
-	x = ((x & 0x55) << 1) | ((x & 0xAA) >> 1);
-	x = ((x & 0x33) << 2) | ((x & 0xCC) >> 2);
-	x = ((x & 0x0F) << 4) | ((x & 0xF0) >> 4);
-	return x;
+	static_assert(width % 8 == 0, "rows must consist of whole bytes");
+	constexpr auto size = frame_size<width, height>;
+	auto mode = static_cast<CompressionMode>(pgm_read_byte(data.data()));
+	data = data.slice(1);
+	output = output.slice(0, size);
+	// without a previous frame (e.g. at the start of a video), the delta is relative to a black frame,
+	// which is the same as not applying the delta at all
+	auto const is_delta = (mode == CompressionMode::NibbleDelta || mode == CompressionMode::PokemonDelta)
+		&& previous_frame.size() >= size;
+
+	// unchecked writers store whole words up to the end of the frame
+	static_assert(is_checked || size % sizeof(uint32_t) == 0);
+	using Writer = FrameWriter<is_checked>;
+	using DeltaWriter = DeltaFrameWriter<is_checked>;
+	using SnakeWriter = SnakeFrameWriter<is_checked>;
+	YieldBudget budget { YieldSubsystem::Video };
+	switch (mode) {
+	case CompressionMode::Turtle:
+		decompress_turtle<width, height>(output, data, budget);
+		break;
+	case CompressionMode::Nibble:
+	case CompressionMode::NibbleDelta:
+		if (is_delta)
+			decompress_nibble(DeltaWriter { output, { output, previous_frame } }, data, budget);
+		else
+			decompress_nibble(Writer { output }, data, budget);
+		break;
+	case CompressionMode::NibbleSnake:
+		decompress_nibble(SnakeWriter { output, { output, width / 8, false } }, data, budget);
+		break;
+	case CompressionMode::PokemonSnake:
+		decompress_pokemon(SnakeWriter { output, { output, width / 8, false } }, data, budget);
+		break;
+	default:
+		if (is_delta)
+			decompress_pokemon(DeltaWriter { output, { output, previous_frame } }, data, budget);
+		else
+			decompress_pokemon(Writer { output }, data, budget);
+		break;
+	}
 }
 
-static void reorder_snake(Span<uint8_t> frame)
+template <size_t width, size_t height>
+void decompress_into(Span<uint8_t> output, Span<uint8_t const> data, Span<uint8_t const> previous_frame)
 {
-	for (size_t row = 0;; ++row) {
-		if (row * row_size >= frame.size())
-			break;
+	decompress_frame<width, height, true>(output, data, previous_frame);
+}
 
-		// only switch odd rows
-		if (row % 2 == 0)
-			continue;
+template <size_t width, size_t height>
+void decompress_validated_into(Span<uint8_t> output, Span<uint8_t const> data, Span<uint8_t const> previous_frame)
+{
+	decompress_frame<width, height, false>(output, data, previous_frame);
+}
+
+template <size_t width, size_t height>
+std::vector<uint8_t> decompress(Span<uint8_t const> data, Span<uint8_t const> previous_frame)
+{
+	std::vector<uint8_t> output(frame_size<width, height>);
+	decompress_into<width, height>(output, data, previous_frame);
+	return output;
+}
+
+template void decompress_into<80, 64>(Span<uint8_t> output, Span<uint8_t const> data, Span<uint8_t const> previous_frame);
+template void decompress_into<128, 64>(Span<uint8_t> output, Span<uint8_t const> data, Span<uint8_t const> previous_frame);
+template std::vector<uint8_t> decompress<80, 64>(Span<uint8_t const> data, Span<uint8_t const> previous_frame);
+template std::vector<uint8_t> decompress<128, 64>(Span<uint8_t const> data, Span<uint8_t const> previous_frame);
+template void decompress_validated_into<80, 64>(Span<uint8_t> output, Span<uint8_t const> data, Span<uint8_t const> previous_frame);
+template void decompress_validated_into<128, 64>(Span<uint8_t> output, Span<uint8_t const> data, Span<uint8_t const> previous_frame);
 
-		for (size_t i = 0; i < row_size / 2; ++i) {
-			auto front_index = row * row_size + i;
-			auto back_index = row * row_size + (row_size - 1 - i);
-			auto front = frame[front_index];
-			auto back = frame[back_index];
-			frame[front_index] = bitswap(back);
-			frame[back_index] = bitswap(front);
+// Transposes an 8x8 bit matrix where bit 8 * i + j is row i, column j (Hacker's Delight, section 7-3).
+static uint64_t transpose_8x8(uint64_t x)
+{
+	uint64_t t;
+	t = (x ^ (x >> 7)) & 0x00aa00aa00aa00aaull;
+	x = x ^ t ^ (t << 7);
+	t = (x ^ (x >> 14)) & 0x0000cccc0000ccccull;
+	x = x ^ t ^ (t << 14);
+	t = (x ^ (x >> 28)) & 0x00000000f0f0f0f0ull;
+	x = x ^ t ^ (t << 28);
+	return x;
+}
+
+void frame_to_tiles(Span<uint8_t> output, size_t output_stride, Span<uint8_t const> frame, size_t width, size_t first_tile_row, size_t tile_row_count)
+{
+	if (tile_row_count == 0)
+		return;
+	auto const frame_row_size = width / 8;
+	// check the bounds once instead of for every byte
+	auto const end_row = (first_tile_row + tile_row_count) * 8;
+	if (frame.size() < end_row * frame_row_size || output.size() < (tile_row_count - 1) * output_stride + width)
+		return;
+
+	for (size_t tile_row = 0; tile_row < tile_row_count; ++tile_row) {
+		auto const* input = frame.data() + (first_tile_row + tile_row) * 8 * frame_row_size;
+		auto* tiles = output.data() + tile_row * output_stride;
+		for (size_t column_byte = 0; column_byte < frame_row_size; ++column_byte) {
+			// XBM rows have the leftmost pixel in the least significant bit, so each row byte is one matrix row
+			uint64_t block = 0;
+			for (size_t row = 0; row < 8; ++row)
+				block |= static_cast<uint64_t>(input[row * frame_row_size + column_byte]) << (8 * row);
+			block = transpose_8x8(block);
+			for (size_t column = 0; column < 8; ++column)
+				tiles[column_byte * 8 + column] = static_cast<uint8_t>(block >> (8 * column));
 		}
 	}
 }
 
-std::vector<uint8_t> decompress(Span<uint8_t> data, size_t pixel_count, Span<uint8_t> previous_frame)
+static bool is_row_streamable(CompressionMode mode)
 {
-	auto mode = static_cast<CompressionMode>(data[0]);
-	data = data.slice(1);
-	std::vector<uint8_t> output;
-	if (mode == CompressionMode::Nibble || mode == CompressionMode::NibbleDelta || mode == CompressionMode::NibbleSnake) {
-		output = decompress_nibble(data, pixel_count);
-	} else {
-		output = decompress_pokemon(data, pixel_count);
-	}
-	yield();
+	return mode == CompressionMode::Nibble || mode == CompressionMode::NibbleSnake || mode == CompressionMode::Pokemon || mode == CompressionMode::PokemonSnake;
+}
 
-	if (mode == CompressionMode::NibbleDelta || mode == CompressionMode::PokemonDelta) {
-		decompress_delta(output, previous_frame);
-	} else if (mode == CompressionMode::NibbleSnake || mode == CompressionMode::PokemonSnake) {
-		reorder_snake(output);
+bool is_row_streamable(Span<uint8_t const> data)
+{
+	return !data.is_empty() && is_row_streamable(static_cast<CompressionMode>(pgm_read_byte(data.data())));
+}
+
+bool RowDecoder::begin(Span<uint8_t const> frame_data, size_t frame_width, size_t frame_height)
+{
+	if (!is_row_streamable(frame_data) || frame_width == 0 || frame_width % 8 != 0)
+		return false;
+
+	mode = pgm_read_byte(frame_data.data());
+	reader = ProgmemReader { frame_data.slice(1) };
+	width = frame_width;
+	current_row = 0;
+	remaining_rows = frame_height;
+	color = 0;
+	pending_run_length = 0;
+	pending_bit_count = 0;
+	has_pending_nibble = false;
+	return true;
+}
+
+void RowDecoder::decode_rows(Span<uint8_t> output, size_t row_count)
+{
+	if (row_count > remaining_rows)
+		row_count = remaining_rows;
+	auto const row_bytes = width / 8;
+	output = output.slice(0, row_count * row_bytes);
+	auto const compression_mode = static_cast<CompressionMode>(mode);
+	if (compression_mode == CompressionMode::NibbleSnake || compression_mode == CompressionMode::PokemonSnake)
+		decode_rows(SnakeFrameWriter<> { output, { output, row_bytes, current_row % 2 == 1 } }, row_count);
+	else
+		decode_rows(FrameWriter<> { output }, row_count);
+	current_row += row_count;
+	remaining_rows -= row_count;
+}
+
+template <typename Writer>
+void RowDecoder::decode_rows(Writer writer, size_t row_count)
+{
+	size_t pixels_left = row_count * width;
+
+	// Returns the part of the run that doesn't fit into the requested rows.
+	auto write_run = [&](uint8_t run_color, size_t length) {
+		auto const fitting_length = length < pixels_left ? length : pixels_left;
+		writer.write_run(run_color, fitting_length);
+		pixels_left -= fitting_length;
+		return length - fitting_length;
+	};
+	auto write_bits = [&](uint8_t bits, uint8_t count) {
+		auto const fitting_count = count < pixels_left ? count : static_cast<uint8_t>(pixels_left);
+		writer.write_bits(bits, fitting_count);
+		pixels_left -= fitting_count;
+		pending_bits = bits >> fitting_count;
+		pending_bit_count = count - fitting_count;
+	};
+
+	if (pending_run_length > 0)
+		pending_run_length = write_run(pending_color, pending_run_length);
+	if (pending_bit_count > 0)
+		write_bits(pending_bits, pending_bit_count);
+
+	auto const is_nibble = static_cast<CompressionMode>(mode) == CompressionMode::Nibble || static_cast<CompressionMode>(mode) == CompressionMode::NibbleSnake;
+	while (pixels_left > 0) {
+		if (is_nibble) {
+			uint8_t run_length;
+			if (has_pending_nibble) {
+				run_length = pending_nibble;
+				has_pending_nibble = false;
+			} else if (!reader.is_at_end()) {
+				auto const input_byte = reader.read_byte();
+				if ((input_byte & full_byte_marker) > 0) {
+					run_length = input_byte & rle_length_limit;
+				} else {
+					run_length = input_byte >> 4;
+					pending_nibble = input_byte & 0xf;
+					has_pending_nibble = true;
+				}
+			} else {
+				// the last run's color continues until the end
+				write_run(1 - color, pixels_left);
+				break;
+			}
+			pending_color = color;
+			pending_run_length = write_run(color, run_length);
+			color = 1 - color;
+		} else {
+			if (reader.is_at_end()) {
+				// missing deltas are black, so the last pixel's color continues until the end
+				write_run(color, pixels_left);
+				break;
+			}
+			auto const input_byte = reader.read_byte();
+			uint8_t const value = input_byte & rle_length_limit;
+			if ((input_byte & full_byte_marker) > 0) {
+				pending_color = color;
+				pending_run_length = write_run(color, value + 7);
+			} else {
+				uint8_t pixels = pgm_read_byte(&prefix_xor_table[value]);
+				if (color == 1)
+					pixels = ~pixels;
+				color = (pixels >> 6) & 1;
+				write_bits(pixels, 7);
+			}
+		}
 	}
-	yield();
+	// the requested rows consist of whole bytes, so this doesn't leave a partial byte behind
+	writer.flush();
+}
 
-	return output;
+static uint16_t read_u16(Span<uint8_t const> data, size_t offset)
+{
+	return data[offset] | (data[offset + 1] << 8);
+}
+
+static uint32_t read_u32(Span<uint8_t const> data, size_t offset)
+{
+	return read_u16(data, offset) | (static_cast<uint32_t>(read_u16(data, offset + 2)) << 16);
+}
+
+constexpr uint8_t keyframe_flag = 1 << 0;
+constexpr uint8_t repeat_flag = 1 << 1;
+constexpr uint8_t shared_flag = 1 << 2;
+constexpr uint8_t row_streamable_flag = 1 << 0;
+constexpr uint8_t checksum_flag = 1 << 1;
+constexpr uint8_t audio_flag = 1 << 2;
+
+bool parse_video_header(Span<uint8_t const> data, VideoHeader& header)
+{
+	if (data.size() < video_header_size)
+		return false;
+	if (data[0] != 'S' || data[1] != 'R' || data[2] != 'L' || data[3] != 'V' || data[4] != container_version)
+		return false;
+
+	header.width = read_u16(data, 6);
+	header.height = read_u16(data, 8);
+	header.frame_rate_numerator = read_u16(data, 10);
+	header.frame_rate_denominator = read_u16(data, 12);
+	header.max_frame_size = read_u16(data, 14);
+	header.frame_count = read_u32(data, 16);
+	header.index_offset = read_u32(data, 20);
+	header.is_row_streamable = (data[5] & row_streamable_flag) > 0;
+	header.has_checksum = (data[5] & checksum_flag) > 0;
+	header.has_audio = (data[5] & audio_flag) > 0;
+	return header.frame_rate_numerator > 0 && header.frame_rate_denominator > 0;
+}
+
+bool parse_audio_header(Span<uint8_t const> data, AudioHeader& header)
+{
+	if (data.size() < audio_header_size)
+		return false;
+
+	header.format = read_u32(data, 0);
+	header.chunk_count = read_u32(data, 4);
+	header.index_offset = read_u32(data, 8);
+	header.size = read_u32(data, 12);
+	return true;
+}
+
+FrameIndexEntry parse_frame_index_entry(Span<uint8_t const> data)
+{
+	auto const flags = data[6];
+	return { read_u32(data, 0), read_u16(data, 4), (flags & keyframe_flag) > 0, (flags & repeat_flag) > 0, (flags & shared_flag) > 0 };
+}
+
+AudioChunkEntry parse_audio_chunk_entry(Span<uint8_t const> data)
+{
+	return { read_u32(data, 0), read_u32(data, 4) };
 }
 
 }
@@ -7,5 +7,145 @@
 #include "Span.h"
 
 namespace SRLV {
-std::vector<uint8_t> decompress(Span<uint8_t> data, size_t pixel_count, Span<uint8_t> previous_frame);
+
+// Number of bytes that a decompressed frame with the given dimensions occupies. The width must be a multiple of 8.
+template <size_t width, size_t height>
+constexpr size_t frame_size = width / 8 * height;
+
+// Decompresses a frame into a caller-owned buffer of at least frame_size<width, height> bytes.
+// The previous frame is only used by inter-frame delta modes. It may be the output buffer itself,
+// in which case delta frames are decoded in place.
+// The decoders are specialized for the frame dimensions; only 80x64 and 128x64 (full screen) are instantiated.
+template <size_t width, size_t height>
+void decompress_into(Span<uint8_t> output, Span<uint8_t const> data, Span<uint8_t const> previous_frame);
+
+template <size_t width, size_t height>
+std::vector<uint8_t> decompress(Span<uint8_t const> data, Span<uint8_t const> previous_frame);
+
+extern template void decompress_into<80, 64>(Span<uint8_t> output, Span<uint8_t const> data, Span<uint8_t const> previous_frame);
+extern template void decompress_into<128, 64>(Span<uint8_t> output, Span<uint8_t const> data, Span<uint8_t const> previous_frame);
+extern template std::vector<uint8_t> decompress<80, 64>(Span<uint8_t const> data, Span<uint8_t const> previous_frame);
+extern template std::vector<uint8_t> decompress<128, 64>(Span<uint8_t const> data, Span<uint8_t const> previous_frame);
+
+// Returns whether a frame with the given pixel count can be decoded without bounds checks:
+// the mode is known, and the runs don't describe more pixels than the frame has. Meant to be run once when loading a video.
+bool validate_frame(Span<uint8_t const> data, size_t pixel_count);
+
+// Like decompress_into, but without bounds checks on the output. The frame must have passed validate_frame.
+template <size_t width, size_t height>
+void decompress_validated_into(Span<uint8_t> output, Span<uint8_t const> data, Span<uint8_t const> previous_frame);
+
+extern template void decompress_validated_into<80, 64>(Span<uint8_t> output, Span<uint8_t const> data, Span<uint8_t const> previous_frame);
+extern template void decompress_validated_into<128, 64>(Span<uint8_t> output, Span<uint8_t const> data, Span<uint8_t const> previous_frame);
+
+// Converts 8-row bands ("tile rows") of a decompressed frame to the vertical tile layout of SSD1306-like displays,
+// where every byte holds 8 vertically stacked pixels, the topmost in the least significant bit.
+// Frame tile row first_tile_row + i is written to output[i * output_stride] and the following width bytes.
+// The width must be a multiple of 8.
+void frame_to_tiles(Span<uint8_t> output, size_t output_stride, Span<uint8_t const> frame, size_t width, size_t first_tile_row, size_t tile_row_count);
+
+// Returns whether RowDecoder can decode the frame, i.e. whether it doesn't use inter-frame deltas or Turtle compression.
+bool is_row_streamable(Span<uint8_t const> data);
+
+// Resumable decoder that produces a frame a few rows at a time, so that the complete frame never has to be in memory.
+class RowDecoder {
+public:
+	// Starts decoding a frame of the given dimensions; the width must be a multiple of 8.
+	// The data must stay valid until the frame is decoded. Returns false if the frame is not row-streamable.
+	bool begin(Span<uint8_t const> data, size_t width, size_t height);
+	// Decodes the next rows into the output, which must hold row_count rows of width / 8 bytes each.
+	void decode_rows(Span<uint8_t> output, size_t row_count);
+
+	size_t rows_left() const { return remaining_rows; }
+
+private:
+	template <typename Writer>
+	void decode_rows(Writer writer, size_t row_count);
+
+	// frame data after the mode byte
+	ProgmemReader reader;
+	uint8_t mode { 0 };
+	size_t width { 0 };
+	size_t current_row { 0 };
+	size_t remaining_rows { 0 };
+	// Nibble: color of the next run; Pokémon: color of the last pixel
+	uint8_t color { 0 };
+	// part of a run that didn't fit into the previous rows
+	uint8_t pending_color { 0 };
+	size_t pending_run_length { 0 };
+	// Pokémon: raw pixels that didn't fit into the previous rows, starting at the LSB
+	uint8_t pending_bits { 0 };
+	uint8_t pending_bit_count { 0 };
+	// Nibble: second run of a byte with two nibbles
+	bool has_pending_nibble { false };
+	uint8_t pending_nibble { 0 };
+};
+
+// Video container, see "Video Format" in Documentation/SRLV.md.
+constexpr uint8_t container_version = 1;
+constexpr size_t video_header_size = 24;
+constexpr size_t frame_index_entry_size = 8;
+// The audio header of files with an interleaved audio track directly follows the video header.
+constexpr size_t audio_header_size = 16;
+constexpr size_t audio_chunk_entry_size = 8;
+// FLAC audio, identified by the "fLaC" FOURCC
+constexpr uint32_t audio_format_flac = 'f' | ('L' << 8) | ('a' << 16) | (static_cast<uint32_t>('C') << 24);
+
+struct VideoHeader {
+	uint16_t width;
+	uint16_t height;
+	uint16_t frame_rate_numerator;
+	uint16_t frame_rate_denominator;
+	// size of the largest frame's compressed data, so that readers can allocate their frame buffer up front
+	uint16_t max_frame_size;
+	uint32_t frame_count;
+	// absolute file offset of the frame index
+	uint32_t index_offset;
+	// all frames can be decoded with RowDecoder
+	bool is_row_streamable;
+	// the file ends with a checksum of everything before it
+	bool has_checksum;
+	// an audio header follows the video header
+	bool has_audio;
+
+	double fps() const { return static_cast<double>(frame_rate_numerator) / frame_rate_denominator; }
+};
+
+struct FrameIndexEntry {
+	// absolute file offset of the frame's compressed data
+	uint32_t offset;
+	uint16_t size;
+	// keyframes don't depend on the previous frame
+	bool is_keyframe;
+	// the frame looks exactly like the previous frame, so players may keep showing that one
+	bool is_repeat;
+	// other frames reuse this frame's data, so caching the decoded keyframe pays off
+	bool is_shared;
+};
+
+struct AudioHeader {
+	// FOURCC of the audio format, e.g. audio_format_flac
+	uint32_t format;
+	uint32_t chunk_count;
+	// absolute file offset of the audio chunk index
+	uint32_t index_offset;
+	// total size of all chunks, i.e. of the audio stream
+	uint32_t size;
+};
+
+// A piece of the audio stream, stored next to the frames of the same time span.
+struct AudioChunkEntry {
+	// absolute file offset of the chunk's data
+	uint32_t offset;
+	uint32_t size;
+};
+
+// Returns false if the data doesn't start with a valid header of a supported container version.
+bool parse_video_header(Span<uint8_t const> data, VideoHeader& header);
+// The data must start at the audio header. Returns false if it is too short.
+bool parse_audio_header(Span<uint8_t const> data, AudioHeader& header);
+// The data must be at least audio_chunk_entry_size bytes long.
+AudioChunkEntry parse_audio_chunk_entry(Span<uint8_t const> data);
+// The data must be at least frame_index_entry_size bytes long.
+FrameIndexEntry parse_frame_index_entry(Span<uint8_t const> data);
 }
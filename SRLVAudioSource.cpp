@@ -0,0 +1,118 @@
+#include "SRLVAudioSource.h"
+
+SRLVAudioSource::SRLVAudioSource(SdFs& card)
+	: card(card)
+{
+}
+
+SRLVAudioSource::~SRLVAudioSource()
+{
+	if (file)
+		file.close();
+}
+
+bool SRLVAudioSource::open(const char* filename)
+{
+	close();
+	file = card.open(filename, O_RDONLY);
+	if (!file)
+		return false;
+
+	std::array<uint8_t, SRLV::video_header_size + SRLV::audio_header_size> header_data {};
+	SRLV::VideoHeader video_header;
+	if (file.read(header_data.data(), header_data.size()) != static_cast<int>(header_data.size())
+		|| !SRLV::parse_video_header({ header_data.data(), SRLV::video_header_size }, video_header) || !video_header.has_audio
+		|| !SRLV::parse_audio_header({ header_data.data() + SRLV::video_header_size, SRLV::audio_header_size }, audio_header)
+		|| audio_header.chunk_count == 0 || !enter_chunk(0, 0)) {
+		close();
+		return false;
+	}
+	start_read_ahead();
+	return true;
+}
+
+bool SRLVAudioSource::read_chunk_entry(uint32_t chunk, SRLV::AudioChunkEntry& entry)
+{
+	if (chunk >= audio_header.chunk_count)
+		return false;
+
+	if (chunk < index_cache_start || chunk >= index_cache_start + index_cache_count) {
+		// chunks are mostly read in order, so the cache is refilled once per AUDIO_INDEX_CACHE_ENTRIES chunks
+		index_cache_start = chunk - chunk % AUDIO_INDEX_CACHE_ENTRIES;
+		index_cache_count = 0;
+		auto const entry_count = std::min<uint32_t>(AUDIO_INDEX_CACHE_ENTRIES, audio_header.chunk_count - index_cache_start);
+		auto const byte_count = entry_count * SRLV::audio_chunk_entry_size;
+		if (!file.seek(audio_header.index_offset + index_cache_start * SRLV::audio_chunk_entry_size))
+			return false;
+		if (file.read(index_cache.data(), byte_count) != static_cast<int>(byte_count))
+			return false;
+		index_cache_count = entry_count;
+	}
+
+	auto const cache_offset = (chunk - index_cache_start) * SRLV::audio_chunk_entry_size;
+	entry = SRLV::parse_audio_chunk_entry({ index_cache.data() + cache_offset, SRLV::audio_chunk_entry_size });
+	return true;
+}
+
+bool SRLVAudioSource::enter_chunk(uint32_t chunk, uint32_t new_chunk_position)
+{
+	SRLV::AudioChunkEntry entry;
+	if (!read_chunk_entry(chunk, entry) || new_chunk_position > entry.size || !file.seek(entry.offset + new_chunk_position))
+		return false;
+	current_chunk = chunk;
+	chunk_entry = entry;
+	chunk_position = new_chunk_position;
+	return true;
+}
+
+int SRLVAudioSource::read_stream(uint8_t* data, uint32_t length)
+{
+	uint32_t total_read = 0;
+	while (total_read < length) {
+		if (chunk_position == chunk_entry.size && !enter_chunk(current_chunk + 1, 0))
+			break;
+		// one contiguous read per chunk piece, which SdFat turns into multi-sector reads
+		auto const piece_length = std::min(length - total_read, chunk_entry.size - chunk_position);
+		auto const bytes_read = file.read(data + total_read, piece_length);
+		if (bytes_read <= 0)
+			break;
+		chunk_position += bytes_read;
+		total_read += bytes_read;
+	}
+	return total_read;
+}
+
+bool SRLVAudioSource::restart_stream(uint32_t new_position)
+{
+	// find the chunk by adding up the chunk sizes
+	uint32_t chunk_start = 0;
+	for (uint32_t chunk = 0; chunk < audio_header.chunk_count; ++chunk) {
+		SRLV::AudioChunkEntry entry;
+		if (!read_chunk_entry(chunk, entry))
+			return false;
+		auto const is_last_chunk = chunk + 1 == audio_header.chunk_count;
+		if (new_position < chunk_start + entry.size || is_last_chunk)
+			return enter_chunk(chunk, new_position - chunk_start);
+		chunk_start += entry.size;
+	}
+	return false;
+}
+
+bool SRLVAudioSource::close()
+{
+	stop_read_ahead();
+	audio_header = {};
+	current_chunk = 0;
+	chunk_entry = {};
+	chunk_position = 0;
+	index_cache_count = 0;
+	if (!file)
+		return false;
+
+	file.close();
+	return true;
+}
+
+bool SRLVAudioSource::isOpen() { return file ? true : false; }
+
+uint32_t SRLVAudioSource::getSize() { return audio_header.size; }
@@ -0,0 +1,52 @@
+/*
+ * Audio source that demuxes the interleaved audio track of an SRLV video file on the SD card.
+ */
+
+#pragma once
+
+#include "AudioFileSourceReadAhead.h"
+#include "SRLV.h"
+#include <SdFat.h>
+#include <array>
+
+// Number of audio chunk index entries that are read from the card at once.
+constexpr size_t AUDIO_INDEX_CACHE_ENTRIES = 16;
+
+// Presents the audio chunks of a video file as one continuous stream, e.g. for AudioGeneratorFLAC.
+// The audio chunks lie next to the frames of the same time span, so this source and the video player (which has its own
+// file handle) both read the file front to back, instead of seeking between two files. Reading ahead keeps the audio reads
+// large and infrequent, so that they rarely get between the video reads.
+class SRLVAudioSource : public AudioFileSourceReadAhead {
+public:
+	SRLVAudioSource(SdFs& card);
+	virtual ~SRLVAudioSource() override;
+
+	// Fails if the video has no audio track.
+	virtual bool open(const char* filename) override;
+	virtual bool close() override;
+	virtual bool isOpen() override;
+	virtual uint32_t getSize() override;
+
+	uint32_t audio_format() const { return audio_header.format; }
+
+protected:
+	virtual int read_stream(uint8_t* data, uint32_t length) override;
+	virtual bool restart_stream(uint32_t new_position) override;
+
+private:
+	bool read_chunk_entry(uint32_t chunk, SRLV::AudioChunkEntry& entry);
+	// Moves to the given position within the given chunk.
+	bool enter_chunk(uint32_t chunk, uint32_t chunk_position);
+
+	SdFs& card;
+	FsFile file;
+	SRLV::AudioHeader audio_header {};
+
+	uint32_t current_chunk { 0 };
+	SRLV::AudioChunkEntry chunk_entry {};
+	uint32_t chunk_position { 0 };
+
+	std::array<uint8_t, AUDIO_INDEX_CACHE_ENTRIES * SRLV::audio_chunk_entry_size> index_cache {};
+	uint32_t index_cache_start { 0 };
+	uint32_t index_cache_count { 0 };
+};
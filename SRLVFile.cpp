@@ -0,0 +1,98 @@
+#include "SRLVFile.h"
+
+SRLVFile::SRLVFile(SdFs& card)
+	: card(card)
+{
+}
+
+bool SRLVFile::open(const char* filename)
+{
+	close();
+	file = card.open(filename, O_RDONLY);
+	if (!file)
+		return false;
+
+	std::array<uint8_t, SRLV::video_header_size> header_data {};
+	auto const header_read = file.read(header_data.data(), header_data.size());
+	if (header_read != static_cast<int>(header_data.size()) || !SRLV::parse_video_header({ header_data.data(), header_data.size() }, video_header)
+		|| video_header.max_frame_size > MAX_COMPRESSED_FRAME_SIZE || video_header.frame_count > MAX_FRAME_COUNT
+		|| video_header.index_offset + static_cast<uint64_t>(video_header.frame_count) * SRLV::frame_index_entry_size > file.fileSize()) {
+		close();
+		return false;
+	}
+
+	if (video_header.has_audio) {
+		std::array<uint8_t, SRLV::audio_header_size> audio_header_data {};
+		auto const audio_header_read = file.read(audio_header_data.data(), audio_header_data.size());
+		if (audio_header_read != static_cast<int>(audio_header_data.size()) || !SRLV::parse_audio_header({ audio_header_data.data(), audio_header_data.size() }, the_audio_header)) {
+			close();
+			return false;
+		}
+	}
+
+	frame_data.resize(video_header.max_frame_size);
+	validated_frames.assign((video_header.frame_count + 7) / 8, 0);
+	return true;
+}
+
+void SRLVFile::close()
+{
+	if (file)
+		file.close();
+	video_header = {};
+	the_audio_header = {};
+	index_cache_count = 0;
+	// actually release the memory; the player only keeps it while a video is open
+	std::vector<uint8_t>().swap(frame_data);
+	std::vector<uint8_t>().swap(validated_frames);
+}
+
+bool SRLVFile::validate_frame(uint32_t frame, Span<uint8_t const> data)
+{
+	if (frame >= video_header.frame_count || data.is_empty())
+		return false;
+	auto& validated_byte = validated_frames[frame / 8];
+	uint8_t const validated_bit = 1 << (frame % 8);
+	if ((validated_byte & validated_bit) > 0)
+		return true;
+	if (!SRLV::validate_frame(data, static_cast<size_t>(video_header.width) * video_header.height))
+		return false;
+	validated_byte |= validated_bit;
+	return true;
+}
+
+bool SRLVFile::read_index_entry(uint32_t frame, SRLV::FrameIndexEntry& entry)
+{
+	if (frame >= video_header.frame_count)
+		return false;
+
+	if (frame < index_cache_start || frame >= index_cache_start + index_cache_count) {
+		// aligned windows serve backwards scans (e.g. searching for keyframes) as well as forward playback
+		index_cache_start = frame - frame % INDEX_CACHE_ENTRIES;
+		index_cache_count = 0;
+		auto const entry_count = std::min<uint32_t>(INDEX_CACHE_ENTRIES, video_header.frame_count - index_cache_start);
+		auto const byte_count = entry_count * SRLV::frame_index_entry_size;
+		if (!file.seek(video_header.index_offset + index_cache_start * SRLV::frame_index_entry_size))
+			return false;
+		if (file.read(index_cache.data(), byte_count) != static_cast<int>(byte_count))
+			return false;
+		index_cache_count = entry_count;
+	}
+
+	auto const cache_offset = (frame - index_cache_start) * SRLV::frame_index_entry_size;
+	entry = SRLV::parse_frame_index_entry({ index_cache.data() + cache_offset, SRLV::frame_index_entry_size });
+	return true;
+}
+
+Span<uint8_t const> SRLVFile::read_frame(uint32_t frame)
+{
+	SRLV::FrameIndexEntry entry;
+	if (!read_index_entry(frame, entry) || entry.size == 0 || entry.size > frame_data.size())
+		return {};
+	if (!file.seek(entry.offset))
+		return {};
+	if (file.read(frame_data.data(), entry.size) != static_cast<int>(entry.size))
+		return {};
+
+	return { frame_data.data(), entry.size };
+}
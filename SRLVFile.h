@@ -0,0 +1,57 @@
+/*
+ * Streaming reader for SRLV video files on the SD card.
+ */
+
+#pragma once
+
+#include "SRLV.h"
+#include "Span.h"
+#include <SdFat.h>
+#include <array>
+#include <vector>
+
+// Largest compressed frame that SRLVFile accepts; files with larger frames are rejected instead of exhausting the heap.
+constexpr size_t MAX_COMPRESSED_FRAME_SIZE = 4096;
+// Longest video that SRLVFile accepts (18 minutes at 30 fps), which bounds the memory for remembering validated frames.
+constexpr uint32_t MAX_FRAME_COUNT = 32768;
+// Number of frame index entries that are read from the card at once.
+constexpr size_t INDEX_CACHE_ENTRIES = 16;
+
+class SRLVFile {
+public:
+	SRLVFile(SdFs& card);
+
+	// Opens the video and allocates the frame buffer (on the currently selected heap).
+	bool open(const char* filename);
+	void close();
+	bool is_open() const { return file.isOpen(); }
+
+	SRLV::VideoHeader const& header() const { return video_header; }
+	uint32_t frame_count() const { return video_header.frame_count; }
+	// Only valid if the header says that the file has audio; SRLVAudioSource plays it.
+	SRLV::AudioHeader const& audio_header() const { return the_audio_header; }
+
+	// Checks the data of a frame from read_frame (see SRLV::validate_frame) and remembers frames that passed, so that each
+	// frame is only checked on its first decode. Frames that passed can be decoded without bounds checks.
+	// Checking frames as they are needed keeps opening a video from reading the whole file.
+	bool validate_frame(uint32_t frame, Span<uint8_t const> data);
+
+	// Returns false if the frame index can't be read.
+	bool read_index_entry(uint32_t frame, SRLV::FrameIndexEntry& entry);
+	// Reads the compressed data of a frame. The data stays valid until the next call or until the file is closed.
+	// Returns an empty span on read errors.
+	Span<uint8_t const> read_frame(uint32_t frame);
+
+private:
+	SdFs& card;
+	FsFile file;
+	SRLV::VideoHeader video_header {};
+	SRLV::AudioHeader the_audio_header {};
+	// one bit per frame that passed validate_frame
+	std::vector<uint8_t> validated_frames {};
+
+	std::vector<uint8_t> frame_data {};
+	std::array<uint8_t, INDEX_CACHE_ENTRIES * SRLV::frame_index_entry_size> index_cache {};
+	uint32_t index_cache_start { 0 };
+	uint32_t index_cache_count { 0 };
+};
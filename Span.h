@@ -300,6 +300,12 @@ public:
 	{
 	}
 
+	ALWAYS_INLINE Span(std::vector<uint8_t> const& vector)
+		: m_values(vector.data())
+		, m_size(vector.size())
+	{
+	}
+
 	template <size_t size>
 	ALWAYS_INLINE constexpr Span(uint8_t const (&values)[size])
 		: m_values(values)
@@ -521,3 +527,335 @@ requires(IsTrivial<T> && !IsConst<T>)
 {
 	return Bytes { static_cast<void*>(span.data()), span.size() * sizeof(T) };
 }
+
+// Flash (PROGMEM) access. The ESP8266 can only read flash with aligned 32-bit loads, so pgm_read_byte costs a word load and a shift per byte,
+// and smaller types can't be read directly at all. Everything here works on data in RAM as well, and on the host.
+
+#ifdef ESP8266
+#include <pgmspace.h>
+constexpr bool progmem_needs_aligned_reads = true;
+#else
+constexpr bool progmem_needs_aligned_reads = false;
+#endif
+
+// Copies data from flash into a RAM buffer for random access. Returns the copied part, which is limited by the buffer size.
+inline ReadonlyBytes copy_from_progmem(ReadonlyBytes source, Bytes buffer)
+{
+	auto const size = source.size() < buffer.size() ? source.size() : buffer.size();
+#ifdef ESP8266
+	memcpy_P(buffer.data(), source.data(), size);
+#else
+	__builtin_memcpy(buffer.data(), source.data(), size);
+#endif
+	return { buffer.data(), size };
+}
+
+template <typename T>
+T read_progmem(T const* source)
+{
+	static_assert(std::is_trivially_copyable_v<T>);
+	T value;
+	copy_from_progmem({ reinterpret_cast<uint8_t const*>(source), sizeof(T) }, { reinterpret_cast<uint8_t*>(&value), sizeof(T) });
+	return value;
+}
+
+// Sequential byte reader for data in flash, which loads every 32-bit word once and serves its bytes from a register.
+// Reading past the end yields zero bytes.
+class ProgmemReader {
+public:
+	ProgmemReader() = default;
+
+	explicit ProgmemReader(ReadonlyBytes data)
+		: end(data.data() + data.size())
+		, remaining(data.size())
+	{
+		if (data.is_empty())
+			return;
+		auto const misalignment = progmem_needs_aligned_reads ? reinterpret_cast<FlatPtr>(data.data()) % sizeof(uint32_t) : 0;
+		next_word = data.data() - misalignment;
+		word = load_word() >> (8 * misalignment);
+		word_bytes_left = sizeof(uint32_t) - misalignment;
+	}
+
+	size_t bytes_left() const { return remaining; }
+	bool is_at_end() const { return remaining == 0; }
+
+	ALWAYS_INLINE uint8_t read_byte()
+	{
+		if (remaining == 0)
+			return 0;
+		--remaining;
+		if (word_bytes_left == 0) {
+			word = load_word();
+			word_bytes_left = sizeof(uint32_t);
+		}
+		uint8_t const byte = word & 0xff;
+		word >>= 8;
+		--word_bytes_left;
+		return byte;
+	}
+
+private:
+	// Loads the next word in little-endian byte order.
+	ALWAYS_INLINE uint32_t load_word()
+	{
+		uint32_t loaded_word = 0;
+		if constexpr (progmem_needs_aligned_reads) {
+			// an aligned word never crosses the end of flash or RAM, even if the data ends within it
+			loaded_word = *reinterpret_cast<uint32_t const*>(__builtin_assume_aligned(next_word, sizeof(uint32_t)));
+		} else {
+			auto const available = static_cast<size_t>(end - next_word);
+			if (available >= sizeof(uint32_t))
+				__builtin_memcpy(&loaded_word, next_word, sizeof(uint32_t));
+			else
+				__builtin_memcpy(&loaded_word, next_word, available);
+		}
+		next_word += sizeof(uint32_t);
+		return loaded_word;
+	}
+
+	uint8_t const* next_word { nullptr };
+	uint8_t const* end { nullptr };
+	size_t remaining { 0 };
+	uint32_t word { 0 };
+	uint8_t word_bytes_left { 0 };
+};
+
+// Bit streams.
+
+// Order of the bits within each byte: LsbFirst fills bytes starting at the least significant bit (e.g. XBM images),
+// MsbFirst starting at the most significant bit.
+enum class BitOrder {
+	LsbFirst,
+	MsbFirst,
+};
+
+// 32-bit loads and stores in memory order (little-endian); aligned addresses use a single word access.
+ALWAYS_INLINE uint32_t load_word(uint8_t const* source)
+{
+	uint32_t word;
+	if (reinterpret_cast<FlatPtr>(source) % sizeof(uint32_t) == 0)
+		__builtin_memcpy(&word, __builtin_assume_aligned(source, sizeof(uint32_t)), sizeof(uint32_t));
+	else
+		__builtin_memcpy(&word, source, sizeof(uint32_t));
+	return word;
+}
+
+ALWAYS_INLINE void store_word(uint8_t* destination, uint32_t word)
+{
+	if (reinterpret_cast<FlatPtr>(destination) % sizeof(uint32_t) == 0)
+		__builtin_memcpy(__builtin_assume_aligned(destination, sizeof(uint32_t)), &word, sizeof(uint32_t));
+	else
+		__builtin_memcpy(destination, &word, sizeof(uint32_t));
+}
+
+// BitWriter store that writes finished words and bytes to the output as they are.
+struct DirectBitStore {
+	ALWAYS_INLINE void store_word(uint8_t* destination, uint32_t word) { ::store_word(destination, word); }
+	ALWAYS_INLINE void store_byte(uint8_t* destination, uint8_t byte) { *destination = byte; }
+	// fill is either 0 or ~0
+	ALWAYS_INLINE void store_fill(uint8_t* destination, uint32_t fill, size_t word_count)
+	{
+		__builtin_memset(destination, static_cast<uint8_t>(fill), word_count * sizeof(uint32_t));
+	}
+};
+
+// Writes bit fields and runs of equal bits into a byte span. Pending bits are kept in a 32-bit accumulator that is written out
+// as a whole word once it is full, so the output only sees word stores, and aligned ones if the output is aligned.
+// Finished words (in memory order), runs of whole words of equal bits and, at the end, single bytes go through the store,
+// which may transform them.
+// Every output byte is stored exactly once, in order.
+// Checked writers drop bits past the end of the output. Unchecked writers need an output size that is a multiple of 4,
+// and must not be given more than 7 bits past the end.
+template <BitOrder order, typename Store = DirectBitStore, bool is_checked = true>
+class BitWriter {
+public:
+	explicit BitWriter(Bytes output, Store store = {})
+		: store(store)
+		, output(output.data())
+		, output_end(output.data() + output.size())
+	{
+	}
+
+	// Writes the lowest count (at most 32) bits of the value, in the writer's bit order.
+	ALWAYS_INLINE void write_bits(uint32_t value, uint8_t count)
+	{
+		if (count == 0)
+			return;
+		if (count < 32)
+			value &= (1u << count) - 1;
+		uint8_t const total_bits = pending_bits + count;
+		if constexpr (order == BitOrder::LsbFirst) {
+			accumulator |= value << pending_bits;
+			if (total_bits < 32) {
+				pending_bits = total_bits;
+				return;
+			}
+			store_accumulator();
+			uint8_t const used_bits = 32 - pending_bits;
+			accumulator = used_bits < 32 ? value >> used_bits : 0;
+		} else {
+			if (total_bits < 32) {
+				accumulator |= value << (32 - total_bits);
+				pending_bits = total_bits;
+				return;
+			}
+			uint8_t const overflow_bits = total_bits - 32;
+			accumulator |= value >> overflow_bits;
+			store_accumulator();
+			accumulator = overflow_bits > 0 ? value << (32 - overflow_bits) : 0;
+		}
+		pending_bits = total_bits - 32;
+	}
+
+	// Writes count copies of the bit.
+	void write_run(bool bit, size_t count)
+	{
+		uint32_t const fill = bit ? ~0u : 0;
+		if (pending_bits > 0) {
+			uint8_t const free_bits = 32 - pending_bits;
+			if (count < free_bits) {
+				write_bits(fill, count);
+				return;
+			}
+			write_bits(fill, free_bits);
+			count -= free_bits;
+		}
+
+		auto word_count = count / 32;
+		if constexpr (is_checked) {
+			auto const words_left = (static_cast<size_t>(output_end - output) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+			if (word_count > words_left)
+				word_count = words_left;
+		}
+		if constexpr (is_checked) {
+			// the last word may only partially fit
+			if (word_count > 0 && output + word_count * sizeof(uint32_t) > output_end) {
+				--word_count;
+				store.store_fill(output, fill, word_count);
+				output += word_count * sizeof(uint32_t);
+				accumulator = fill;
+				store_accumulator();
+				word_count = 0;
+			}
+		}
+		if (word_count > 0) {
+			store.store_fill(output, fill, word_count);
+			output += word_count * sizeof(uint32_t);
+		}
+		accumulator = 0;
+		write_bits(fill, count % 32);
+	}
+
+	// Fills the rest of the output with the bit, and writes out all pending bits.
+	void fill_to_end(bool bit)
+	{
+		auto const bits_left = static_cast<size_t>(output_end - output) * 8;
+		if (pending_bits < bits_left)
+			write_run(bit, bits_left - pending_bits);
+		flush();
+	}
+
+	// Writes out all pending bits; a partial last byte is padded with zero bits. Bits past the end of the output are always dropped here.
+	void flush()
+	{
+		auto byte_count = static_cast<size_t>((pending_bits + 7) / 8);
+		if (byte_count > static_cast<size_t>(output_end - output))
+			byte_count = output_end - output;
+		for (size_t i = 0; i < byte_count; ++i) {
+			if constexpr (order == BitOrder::LsbFirst)
+				store.store_byte(output + i, static_cast<uint8_t>(accumulator >> (8 * i)));
+			else
+				store.store_byte(output + i, static_cast<uint8_t>(accumulator >> (24 - 8 * i)));
+		}
+		output += byte_count;
+		accumulator = 0;
+		pending_bits = 0;
+	}
+
+private:
+	ALWAYS_INLINE void store_accumulator()
+	{
+		// the first bit goes into the first byte, which is the least significant one in memory order
+		auto const word = order == BitOrder::LsbFirst ? accumulator : __builtin_bswap32(accumulator);
+		if (is_checked && output_end - output < static_cast<ptrdiff_t>(sizeof(uint32_t))) {
+			for (size_t i = 0; output != output_end; ++output, ++i)
+				store.store_byte(output, static_cast<uint8_t>(word >> (8 * i)));
+			return;
+		}
+		store.store_word(output, word);
+		output += sizeof(uint32_t);
+	}
+
+	Store store;
+	uint8_t* output;
+	uint8_t* const output_end;
+	uint32_t accumulator { 0 };
+	// number of bits in the accumulator, at the low end for LsbFirst writers and at the high end for MsbFirst writers
+	uint8_t pending_bits { 0 };
+};
+
+// Reads bits from data that may be in flash. The next bits are kept in a 32-bit window that is refilled bytewise.
+// Reading past the end yields zero bits.
+template <BitOrder order>
+class BitReader {
+public:
+	explicit BitReader(ReadonlyBytes data)
+		: reader(data)
+		, bit_count(data.size() * 8)
+	{
+		refill();
+	}
+
+	size_t bits_left() const { return bit_position < bit_count ? bit_count - bit_position : 0; }
+
+	// Returns the next count (at most 16) bits; for MsbFirst readers, the first bit is the most significant one of the result.
+	ALWAYS_INLINE uint16_t peek_bits(uint8_t count) const
+	{
+		if (count == 0)
+			return 0;
+		if constexpr (order == BitOrder::LsbFirst)
+			return window & ((1u << count) - 1);
+		else
+			return window >> (32 - count);
+	}
+
+	ALWAYS_INLINE void skip_bits(uint8_t count)
+	{
+		bit_position += count;
+		if constexpr (order == BitOrder::LsbFirst)
+			window >>= count;
+		else
+			window <<= count;
+		window_bits -= count;
+		refill();
+	}
+
+	ALWAYS_INLINE uint16_t read_bits(uint8_t count)
+	{
+		auto const bits = peek_bits(count);
+		skip_bits(count);
+		return bits;
+	}
+
+	void align_to_byte_boundary() { skip_bits((8 - bit_position % 8) % 8); }
+
+private:
+	// keeps at least 25 bits in the window
+	ALWAYS_INLINE void refill()
+	{
+		while (window_bits <= 24) {
+			if constexpr (order == BitOrder::LsbFirst)
+				window |= static_cast<uint32_t>(reader.read_byte()) << window_bits;
+			else
+				window |= static_cast<uint32_t>(reader.read_byte()) << (24 - window_bits);
+			window_bits += 8;
+		}
+	}
+
+	ProgmemReader reader;
+	size_t bit_count;
+	size_t bit_position { 0 };
+	uint32_t window { 0 };
+	uint8_t window_bits { 0 };
+};
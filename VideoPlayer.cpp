@@ -2,8 +2,9 @@
 #include "Audio.h"
 #include "DisplayUtils.h"
 #include "Globals.h"
-#include "bad_apple.h"
+#include "string_constants.h"
 #include <Arduino.h>
+#include <algorithm>
 #include <umm_malloc/umm_heap_select.h>
 #include <user_interface.h>
 #include <vector>
@@ -12,82 +13,418 @@
 // (Can't include user_interface in the header itself since it's platform-independent.)
 #include "SRLV.h"
 
-constexpr size_t ROW_SIZE = IMAGE_WIDTH / 8 + 1;
+static_assert(VIDEO_HEIGHT % 8 == 0, "video must consist of whole display tile rows");
+
+// Copies the decoded rows of the given width that lie in the current page straight into the display buffer; the video is at the top of the screen.
+// The rows start at the given tile row of the video, and may be the entire frame.
+// This requires the display's vertical tile layout (SSD1306) and no display rotation.
+static void blit_rows(Display* display, uint16_t x, Span<uint8_t const> rows, uint16_t width, uint8_t first_tile_row)
+{
+	uint8_t const page_tile_row = display->getBufferCurrTileRow();
+	uint8_t const page_tile_rows = display->getBufferTileHeight();
+	constexpr uint8_t frame_tile_rows = VIDEO_HEIGHT / 8;
+	uint8_t const rows_end = first_tile_row + rows.size() / width;
+
+	auto const start = std::max(page_tile_row, first_tile_row);
+	auto const end = std::min({ static_cast<uint8_t>(page_tile_row + page_tile_rows), rows_end, frame_tile_rows });
+	if (start >= end)
+		return;
+
+	size_t const buffer_width = display->getBufferTileWidth() * 8;
+	auto const buffer_offset = (start - page_tile_row) * buffer_width + x;
+	Span<uint8_t> buffer { display->getBufferPtr() + buffer_offset, page_tile_rows * buffer_width - buffer_offset };
+	SRLV::frame_to_tiles(buffer, buffer_width, rows, width, start - first_tile_row, end - start);
+}
+
+VideoPlayer::VideoPlayer(String file_name)
+	: video(card)
+	, audio_track(card)
+	, video_file_name(file_name)
+{
+}
+
+VideoPlayer::~VideoPlayer()
+{
+	// the audio manager may still be reading the audio track
+	close_video();
+}
+
+bool VideoPlayer::open_video()
+{
+	if (video.is_open())
+		return true;
+	// don't hammer the card every frame if the video isn't there
+	if (could_not_open)
+		return false;
+
+	// the frame data buffer lives as long as the video is open, which is too long for the main heap
+	HeapSelectIram iram;
+	if (!video.open(video_file_name.c_str()) || video.frame_count() == 0 || video.header().height != VIDEO_HEIGHT) {
+		close_video();
+		could_not_open = true;
+		return false;
+	}
+	// Validated frames can't exceed the frame buffers, so they are decoded without bounds checks (see catch_up).
+	// The row decoder always checks bounds, so row-streamable videos aren't validated.
+	auto const width = video.header().width;
+	if (width == LETTERBOXED_VIDEO_WIDTH) {
+		decompress_frame = SRLV::decompress_into<LETTERBOXED_VIDEO_WIDTH, VIDEO_HEIGHT>;
+		decompress_validated_frame = SRLV::decompress_validated_into<LETTERBOXED_VIDEO_WIDTH, VIDEO_HEIGHT>;
+	} else if (width == FULL_SCREEN_VIDEO_WIDTH) {
+		decompress_frame = SRLV::decompress_into<FULL_SCREEN_VIDEO_WIDTH, VIDEO_HEIGHT>;
+		decompress_validated_frame = SRLV::decompress_validated_into<FULL_SCREEN_VIDEO_WIDTH, VIDEO_HEIGHT>;
+	} else {
+		close_video();
+		could_not_open = true;
+		return false;
+	}
+
+	// full frames are only needed for delta frames and Turtle frames
+	if (!video.header().is_row_streamable) {
+		for (auto& buffer : frame_buffers)
+			buffer.resize(width / 8 * VIDEO_HEIGHT);
+		for (auto& cached_frame : frame_cache) {
+			cached_frame.is_used = false;
+			cached_frame.pixels.resize(width / 8 * VIDEO_HEIGHT);
+		}
+	}
+
+	current_frame = 0;
+	decoded_frame = NO_DECODED_FRAME;
+	drawn_frame = NO_DECODED_FRAME;
+	is_decoded_ahead = false;
+	deadline_stats = {};
+	time_since_last_frame = 0;
+	return true;
+}
+
+void VideoPlayer::close_video()
+{
+	if (audio_track.isOpen()) {
+		AudioManager::the().stop();
+		audio_track.close();
+	}
+	video.close();
+	decompress_frame = nullptr;
+	decompress_validated_frame = nullptr;
+	// actually release the memory
+	for (auto& buffer : frame_buffers)
+		std::vector<uint8_t>().swap(buffer);
+	for (auto& cached_frame : frame_cache) {
+		cached_frame.is_used = false;
+		std::vector<uint8_t>().swap(cached_frame.pixels);
+	}
+	std::vector<uint8_t>().swap(strip_buffer);
+}
+
+size_t VideoPlayer::find_decode_start(size_t target_frame)
+{
+	// decoding the frames in between is only possible when moving forwards
+	auto const can_continue = decoded_frame != NO_DECODED_FRAME && decoded_frame < target_frame;
+	auto const first_candidate = can_continue ? decoded_frame + 1 : 0;
+
+	// any keyframe after the decoded frame is at least as cheap as decoding all frames in between
+	for (auto frame = target_frame; frame > first_candidate; --frame) {
+		SRLV::FrameIndexEntry entry;
+		// without the entry, the frame may be a delta frame, which needs its predecessor; catch_up retries the read
+		if (!video.read_index_entry(frame, entry))
+			return first_candidate;
+		if (entry.is_keyframe)
+			return frame;
+	}
+	return first_candidate;
+}
+
+size_t VideoPlayer::catch_up(size_t target_frame)
+{
+	if (decoded_frame == target_frame)
+		return 0;
+
+	auto frame = find_decode_start(target_frame);
+	// starting over from the first frame, which is relative to a black frame if it's a delta frame
+	if (frame == 0)
+		std::fill(frame_buffers[1 - current_buffer].begin(), frame_buffers[1 - current_buffer].end(), 0);
+
+	size_t decoded_count = 0;
+	for (; frame <= target_frame && decoded_count < MAX_CATCH_UP_FRAMES; ++frame) {
+		yield();
+		SRLV::FrameIndexEntry entry;
+		// try again with the next draw
+		if (!video.read_index_entry(frame, entry))
+			break;
+		// repeated frames don't change the decoded frame
+		if (entry.is_repeat && frame > 0 && decoded_frame == frame - 1) {
+			decoded_frame = frame;
+			continue;
+		}
+
+		auto& output = frame_buffers[current_buffer];
+		if (!entry.is_shared || !read_cached_frame(entry.offset, { output.data(), output.size() })) {
+			auto const frame_data = video.read_frame(frame);
+			if (frame_data.is_empty())
+				break;
+			yield();
+
+			// each frame is validated on its first decode, which is cheaper than reading the whole file up front
+			auto const decompress = video.validate_frame(frame, frame_data) ? decompress_validated_frame : decompress_frame;
+			auto const& previous_frame = frame_buffers[1 - current_buffer];
+			decompress({ output.data(), output.size() }, frame_data, { previous_frame.data(), previous_frame.size() });
+			if (entry.is_shared)
+				cache_frame(entry.offset, { output.data(), output.size() });
+		}
+		current_buffer = 1 - current_buffer;
+		decoded_frame = frame;
+		++decoded_count;
+	}
+	return decoded_count;
+}
+
+bool VideoPlayer::read_cached_frame(uint32_t data_offset, Span<uint8_t> output)
+{
+	for (auto& cached_frame : frame_cache) {
+		if (!cached_frame.is_used || cached_frame.data_offset != data_offset)
+			continue;
+		cached_frame.last_use = ++cache_clock;
+		memcpy(output.data(), cached_frame.pixels.data(), std::min(output.size(), cached_frame.pixels.size()));
+		return true;
+	}
+	return false;
+}
+
+void VideoPlayer::cache_frame(uint32_t data_offset, Span<uint8_t const> frame)
+{
+	auto* least_recently_used = &frame_cache[0];
+	for (auto& cached_frame : frame_cache) {
+		if (!cached_frame.is_used) {
+			least_recently_used = &cached_frame;
+			break;
+		}
+		if (cached_frame.last_use < least_recently_used->last_use)
+			least_recently_used = &cached_frame;
+	}
+	least_recently_used->is_used = true;
+	least_recently_used->data_offset = data_offset;
+	least_recently_used->last_use = ++cache_clock;
+	memcpy(least_recently_used->pixels.data(), frame.data(), std::min(frame.size(), least_recently_used->pixels.size()));
+}
+
+bool VideoPlayer::advance_to(size_t frame)
+{
+	// a previous draw couldn't decode all frames up to the current frame
+	auto const is_catching_up = drawn_frame != current_frame;
+	current_frame = frame;
+	if (is_catching_up)
+		return true;
+	if (frame == drawn_frame)
+		return false;
+	// skipping backwards or far ahead is rare enough to not bother
+	if (frame < drawn_frame || frame - drawn_frame > MAX_CATCH_UP_FRAMES)
+		return true;
+
+	for (auto next_frame = drawn_frame + 1; next_frame <= frame; ++next_frame) {
+		SRLV::FrameIndexEntry entry;
+		if (!video.read_index_entry(next_frame, entry) || !entry.is_repeat)
+			return true;
+	}
+	// the displayed frame stays as it is
+	drawn_frame = frame;
+	if (decoded_frame < frame)
+		decoded_frame = frame;
+	return false;
+}
+
+void VideoPlayer::decode_ahead()
+{
+	if (video.header().is_row_streamable || is_decoded_ahead || drawn_frame != current_frame || decoded_frame != current_frame)
+		return;
+	// starting over at the first frame would overwrite the drawn frame
+	auto const next_frame = current_frame + 1;
+	if (next_frame >= video.frame_count())
+		return;
+
+	auto const start_time = micros();
+	catch_up(next_frame);
+	if (decoded_frame != next_frame)
+		return;
+	decode_ahead_time = micros() - start_time;
+	is_decoded_ahead = true;
+}
+
+void VideoPlayer::record_deadline(size_t skipped_frames, uint32_t decode_time, uint32_t draw_time)
+{
+	auto const& header = video.header();
+	auto const frame_duration = static_cast<uint32_t>(1'000'000ull * header.frame_rate_denominator / header.frame_rate_numerator);
+	if (decode_time + draw_time > frame_duration) {
+		if (decode_time > draw_time)
+			++deadline_stats.missed_by_decode;
+		else
+			++deadline_stats.missed_by_flush;
+	} else if (skipped_frames > 0) {
+		++deadline_stats.missed_by_loop;
+	}
+}
 
 Menu* VideoPlayer::draw_menu(Display* display, uint16_t delta_millis)
 {
 	// the 1.3K of main heap we might have left when entering this function are not enough.
 	HeapSelectIram iram;
 
-	auto* current_frame_data_progmem = frames[current_frame];
-	auto current_frame_size = frame_sizes[current_frame];
+	if (!open_video()) {
+		display->firstPage();
+		do {
+			display->setFont(MAIN_FONT);
+			draw_string(display, video_missing_label, 0);
+		} while (display->nextPage());
+		return this;
+	}
 
 	yield();
-	auto start_time = eeprom_settings.show_debug ? micros() : 0;
-	auto decompressed = SRLV::decompress({ current_frame_data_progmem, current_frame_size }, IMAGE_WIDTH * IMAGE_HEIGHT, last_frame);
-	auto end_time = eeprom_settings.show_debug ? micros() : 0;
+	uint16_t const x = (display->getWidth() - video.header().width) / 2;
+	if (video.header().is_row_streamable) {
+		// on read errors, the display keeps showing the last frame
+		draw_streaming(display, x);
+		return this;
+	}
+
+	auto const skipped_frames = drawn_frame != NO_DECODED_FRAME && current_frame > drawn_frame ? current_frame - drawn_frame - 1 : 0;
+	// after decoding ahead, this is just a blit
+	auto const was_decoded_ahead = is_decoded_ahead && decoded_frame == current_frame;
+	is_decoded_ahead = false;
+	auto const start_time = micros();
+	// on read errors, this keeps showing the last decoded frame
+	auto const decoded_count = catch_up(current_frame);
+	auto const decode_time = was_decoded_ahead ? decode_ahead_time : micros() - start_time;
+	auto const& decompressed = frame_buffers[1 - current_buffer];
 	yield();
 
-	auto x = (display->getWidth() - IMAGE_WIDTH) / 2;
+	auto const draw_start = micros();
 	display->setDrawColor(1);
 	display->firstPage();
 	do {
 		yield();
-		auto draw_start = eeprom_settings.show_debug ? micros() : 0;
-		display->drawXBM(x, 0, IMAGE_WIDTH, IMAGE_HEIGHT, decompressed.data());
+		blit_rows(display, x, { decompressed.data(), decompressed.size() }, video.header().width, 0);
 
-		if (eeprom_settings.show_debug) {
-			auto freq = system_get_cpu_freq();
-			auto draw_end = micros();
-			yield();
-			char frame_info_text[256] {};
-			snprintf_P(frame_info_text, sizeof(frame_info_text),
-				PSTR("f %ld=%.1f pos %.2f cf %3d\nsr %ld sn %ld\ndec  %5ld\ndraw %5ld\nheap %d"),
-				current_frame, AudioManager::the().current_position() * FPS, AudioManager::the().current_position(), freq, AudioManager::the().sample_rate(), AudioManager::the().played_sample_count(), end_time - start_time, draw_end - draw_start, system_get_free_heap_size());
-			yield();
-			display->setFont(TINY_FONT);
-			yield();
-			display->setDrawColor(2);
-			draw_string(display, frame_info_text, 0);
-		}
+		if (eeprom_settings.show_debug)
+			draw_debug_overlay(display, decode_time, decoded_count, was_decoded_ahead, micros() - draw_start);
 		yield();
 	} while (display->nextPage());
-
 	yield();
-	last_frame = decompressed;
 
+	drawn_frame = decoded_frame;
+	if (was_decoded_ahead)
+		++deadline_stats.decoded_ahead;
+	record_deadline(skipped_frames, was_decoded_ahead ? 0 : decode_time, micros() - draw_start);
 	return this;
 }
 
+bool VideoPlayer::draw_streaming(Display* display, uint16_t x)
+{
+	auto const skipped_frames = drawn_frame != NO_DECODED_FRAME && current_frame > drawn_frame ? current_frame - drawn_frame - 1 : 0;
+	auto const start_time = micros();
+	auto const frame_data = video.read_frame(current_frame);
+	auto const width = video.header().width;
+	if (!row_decoder.begin(frame_data, width, VIDEO_HEIGHT))
+		return false;
+	uint32_t decode_time = micros() - start_time;
+	yield();
+
+	size_t const page_rows = display->getBufferTileHeight() * 8;
+	strip_buffer.resize(page_rows * width / 8);
+
+	display->setDrawColor(1);
+	display->firstPage();
+	do {
+		yield();
+		// pages are drawn top to bottom, so the decoder continues where it left off in the previous page
+		auto const decode_start = micros();
+		uint8_t const page_tile_row = display->getBufferCurrTileRow();
+		auto const row_count = std::min(page_rows, row_decoder.rows_left());
+		row_decoder.decode_rows({ strip_buffer.data(), strip_buffer.size() }, row_count);
+		auto const draw_start = micros();
+		decode_time += draw_start - decode_start;
+
+		blit_rows(display, x, { strip_buffer.data(), row_count * width / 8 }, width, page_tile_row);
+
+		if (eeprom_settings.show_debug)
+			draw_debug_overlay(display, last_streaming_decode_time, 1, false, micros() - draw_start);
+		yield();
+	} while (display->nextPage());
+	yield();
+
+	decoded_frame = current_frame;
+	drawn_frame = current_frame;
+	last_streaming_decode_time = decode_time;
+	// pages are decoded while drawing, so the rest of the time went into drawing and sending them
+	record_deadline(skipped_frames, decode_time, micros() - start_time - decode_time);
+	return true;
+}
+
+void VideoPlayer::draw_debug_overlay(Display* display, uint32_t decode_time, size_t decoded_count, bool was_decoded_ahead, uint32_t draw_time)
+{
+	auto freq = system_get_cpu_freq();
+	yield();
+	char frame_info_text[256] {};
+	snprintf_P(frame_info_text, sizeof(frame_info_text),
+		PSTR("f %ld/%ld=%.1f pos %.2f cf %3d\nsr %ld sn %ld\ndec  %5ld (%d)%s\ndraw %5ld heap %d\nmiss dec %ld fl %ld loop %ld ah %ld"),
+		decoded_frame, current_frame, AudioManager::the().current_position() * video.header().fps(), AudioManager::the().current_position(), freq, AudioManager::the().sample_rate(), AudioManager::the().played_sample_count(), decode_time, decoded_count, was_decoded_ahead ? " ahead" : "", draw_time, system_get_free_heap_size(),
+		deadline_stats.missed_by_decode, deadline_stats.missed_by_flush, deadline_stats.missed_by_loop, deadline_stats.decoded_ahead);
+	yield();
+	display->setFont(TINY_FONT);
+	yield();
+	display->setDrawColor(2);
+	draw_string(display, frame_info_text, 0);
+}
+
 bool VideoPlayer::should_refresh(uint16_t delta_millis)
 {
+	if (!open_video())
+		return false;
+
+	auto const& header = video.header();
 	if (!AudioManager::the().is_playing()) {
-		time_since_last_frame += delta_millis;
-		if (time_since_last_frame >= MILLIS_PER_FRAME) {
-			time_since_last_frame -= MILLIS_PER_FRAME;
-			current_frame = (current_frame + 1) % (sizeof(frames) / sizeof(*frames));
-			return true;
-		} else {
-			return false;
+		// frame duration is 1000 * denominator / numerator milliseconds
+		uint32_t const millis_per_frame_scaled = 1000 * header.frame_rate_denominator;
+		time_since_last_frame += static_cast<uint32_t>(delta_millis) * header.frame_rate_numerator;
+		if (time_since_last_frame >= millis_per_frame_scaled) {
+			time_since_last_frame -= millis_per_frame_scaled;
+			// don't try to catch up after long stalls
+			if (time_since_last_frame >= millis_per_frame_scaled)
+				time_since_last_frame = 0;
+			return advance_to((current_frame + 1) % video.frame_count());
 		}
+		// a previous draw couldn't decode all frames up to the current frame
+		if (drawn_frame != current_frame)
+			return true;
+		decode_ahead();
+		return false;
 	}
 	// FIXME: magic number here is a hack to fix a consistent A/V desync. may be 44.1/48 confusion but idk.
 	constexpr auto adjustment = (219.0 / 224.0);
-	auto new_frame = static_cast<size_t>(AudioManager::the().current_position() * FPS * adjustment) % (sizeof(frames) / sizeof(*frames));
-	auto should_refresh = new_frame != current_frame;
-
-	current_frame = new_frame;
-	return should_refresh;
+	auto new_frame = static_cast<size_t>(AudioManager::the().current_position() * header.fps() * adjustment) % video.frame_count();
+	if (advance_to(new_frame))
+		return true;
+	decode_ahead();
+	return false;
 }
 
 Menu* VideoPlayer::handle_button(uint8_t buttons)
 {
 	if (buttons & BUTTON_LEFT) {
+		// free the buffers and retry opening the next time
+		close_video();
+		could_not_open = false;
 		return this->parent;
 	}
 	if (buttons & BUTTON_RIGHT) {
-		String bad_apple(F("Bad Apple.flac"));
-		AudioManager::the().play(bad_apple);
+		// prefer the video's own audio track over a separate audio file next to it; the track may still be playing
+		AudioManager::the().stop();
+		if (video.is_open() && video.header().has_audio && video.audio_header().format == SRLV::audio_format_flac
+			&& audio_track.open(video_file_name.c_str())) {
+			AudioManager::the().play_flac(audio_track);
+		} else {
+			String audio_file_name = video_file_name.substring(0, video_file_name.lastIndexOf('.')) + ".flac";
+			AudioManager::the().play(audio_file_name);
+		}
 	}
 	return this;
 }
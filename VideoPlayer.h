@@ -1,22 +1,112 @@
 #pragma once
 
 #include "Menu.h"
+#include "SRLVAudioSource.h"
+#include "SRLVFile.h"
+#include <array>
+#include <vector>
 
-constexpr double FPS = 8;
-constexpr uint16_t MILLIS_PER_FRAME = static_cast<uint16_t>((1.0 / FPS) * 1000.0);
-constexpr int IMAGE_WIDTH = 80;
-constexpr int IMAGE_HEIGHT = 64;
+// Dimensions of the frames that the player can decode: letterboxed (the original 4:3 video) or full screen.
+// Videos with other dimensions are rejected, since the decoders are specialized for these.
+constexpr uint16_t LETTERBOXED_VIDEO_WIDTH = 80;
+constexpr uint16_t FULL_SCREEN_VIDEO_WIDTH = 128;
+constexpr uint16_t VIDEO_HEIGHT = 64;
+// Maximum number of frames decoded per draw when catching up after skipped frames.
+// If there are more, the rest is decoded during the next draws so that the UI stays responsive.
+constexpr size_t MAX_CATCH_UP_FRAMES = 8;
+// decoded_frame value before any frame was decoded; frame 0 is decoded relative to a black frame
+constexpr size_t NO_DECODED_FRAME = SIZE_MAX;
+// Number of decoded shared keyframes (typically solid black or white frames) that are kept to avoid decoding them again.
+constexpr size_t FRAME_CACHE_SIZE = 3;
 
 class VideoPlayer : public Menu {
 public:
+	// Plays the SRLV video at the given path on the SD card.
+	explicit VideoPlayer(String file_name);
+	~VideoPlayer();
+
 	virtual Menu* ICACHE_RAM_ATTR draw_menu(Display* display, uint16_t delta_millis) override;
 	virtual bool ICACHE_RAM_ATTR should_refresh(uint16_t delta_millis) override;
 	virtual Menu* ICACHE_RAM_ATTR handle_button(uint8_t buttons) override;
 
 private:
+	// Opens the video file if that hasn't happened yet. Returns whether a playable video is open.
+	bool ICACHE_FLASH_ATTR open_video();
+	// Closes the video and frees all buffers.
+	void ICACHE_FLASH_ATTR close_video();
+	// Returns the frame to start decoding at to reach the target frame: either the frame after the decoded frame,
+	// or the closest keyframe in between, whichever needs fewer frames to be decoded.
+	size_t ICACHE_RAM_ATTR find_decode_start(size_t target_frame);
+	// Decodes frames up to the target frame without drawing them. Returns the number of decoded frames.
+	size_t ICACHE_RAM_ATTR catch_up(size_t target_frame);
+	// Makes the given frame the current frame. Returns whether it needs to be drawn,
+	// which isn't the case if it and all frames since the displayed frame are repeats of the displayed frame.
+	bool ICACHE_RAM_ATTR advance_to(size_t frame);
+	// Copies the decoded frame with the given data offset from the cache. Returns false if it isn't cached.
+	bool ICACHE_RAM_ATTR read_cached_frame(uint32_t data_offset, Span<uint8_t> output);
+	// Puts a decoded frame into the cache, replacing the least recently used frame.
+	void ICACHE_RAM_ATTR cache_frame(uint32_t data_offset, Span<uint8_t const> frame);
+	// Decodes the frame after the drawn frame into the spare frame buffer while there's nothing to draw,
+	// so that drawing it only needs a blit.
+	void ICACHE_RAM_ATTR decode_ahead();
+	// Decodes and draws the current frame page by page with the row decoder. Returns false if the frame can't be read.
+	bool ICACHE_RAM_ATTR draw_streaming(Display* display, uint16_t x);
+	// Counts a missed frame deadline if frames were skipped since the last draw or the draw took longer than a frame.
+	void ICACHE_RAM_ATTR record_deadline(size_t skipped_frames, uint32_t decode_time, uint32_t draw_time);
+	void ICACHE_RAM_ATTR draw_debug_overlay(Display* display, uint32_t decode_time, size_t decoded_count, bool was_decoded_ahead, uint32_t draw_time);
+
+	SRLVFile video;
+	String video_file_name;
+	// the audio track interleaved with the video, if it has one; read through its own file handle
+	SRLVAudioSource audio_track;
+	bool could_not_open { false };
+	// decoders for the dimensions of the open video, with and without bounds checks
+	void (*decompress_frame)(Span<uint8_t> output, Span<uint8_t const> data, Span<uint8_t const> previous_frame) { nullptr };
+	void (*decompress_validated_frame)(Span<uint8_t> output, Span<uint8_t const> data, Span<uint8_t const> previous_frame) { nullptr };
+
+	// frame that should be displayed
 	size_t current_frame { 0 };
-	// used when not a/v syncing
+	// frame that was last decoded, i.e. the previous frame for the next delta frame
+	size_t decoded_frame { NO_DECODED_FRAME };
+	// frame that was last drawn; the decoded frame is one ahead of it after decoding ahead
+	size_t drawn_frame { NO_DECODED_FRAME };
+	// whether the decoded frame was decoded ahead and hasn't been drawn yet, and how long that took
+	bool is_decoded_ahead { false };
+	uint32_t decode_ahead_time { 0 };
+	// used when not a/v syncing; counts milliseconds multiplied by the frame rate numerator to avoid rounding
 	uint32_t time_since_last_frame { 0 };
 
-	std::vector<uint8_t> last_frame {};
+	// Ping-pong buffers; decoding writes to the current buffer and then switches, so that the other buffer always holds the decoded frame.
+	// After decoding ahead, the current buffer still holds the drawn frame.
+	// Only allocated for videos that aren't row-streamable. (Heap allocations are word-aligned, and so are the frame sizes.)
+	std::array<std::vector<uint8_t>, 2> frame_buffers {};
+	uint8_t current_buffer { 0 };
+
+	// Decoded shared keyframes, identified by their data offset in the file. Allocated together with the frame buffers.
+	struct CachedFrame {
+		bool is_used { false };
+		uint32_t data_offset { 0 };
+		// value of cache_clock at the last use
+		uint32_t last_use { 0 };
+		std::vector<uint8_t> pixels {};
+	};
+	std::array<CachedFrame, FRAME_CACHE_SIZE> frame_cache {};
+	uint32_t cache_clock { 0 };
+
+	// Row-streamable videos are decoded one display page at a time into this buffer instead.
+	SRLV::RowDecoder row_decoder;
+	std::vector<uint8_t> strip_buffer {};
+	// decode time of the last streamed frame, since it is only known after the last page
+	uint32_t last_streaming_decode_time { 0 };
+
+	// Missed frame deadlines by cause: the draw took longer than a frame mostly because of decoding or because of
+	// sending the pages to the display, or the draw itself was fast enough but frames were skipped (e.g. due to WiFi or audio).
+	struct DeadlineStats {
+		uint32_t missed_by_decode { 0 };
+		uint32_t missed_by_flush { 0 };
+		uint32_t missed_by_loop { 0 };
+		// draws whose frame was decoded ahead
+		uint32_t decoded_ahead { 0 };
+	};
+	DeadlineStats deadline_stats {};
 };
@@ -0,0 +1,112 @@
+/** Budgeted cooperative yielding. */
+
+#pragma once
+
+#include "Span.h"
+#include <array>
+#include <stdint.h>
+
+#ifdef ESP8266
+#include <Arduino.h>
+#else
+#include <chrono>
+#ifndef yield
+#define yield()
+#endif
+#endif
+
+// Parts of the firmware that run long computations, each with its own yield budget and statistics.
+enum class YieldSubsystem : uint8_t {
+	Video,
+	Drawing,
+	ClockFaces,
+	__Count,
+};
+
+struct YieldStats {
+	// how often the budget was checked, i.e. how often yield() used to be called
+	uint32_t checks { 0 };
+	uint32_t yields { 0 };
+};
+
+constexpr size_t yield_subsystem_count = static_cast<size_t>(YieldSubsystem::__Count);
+
+#ifdef ESP8266
+constexpr uint32_t yield_cycles_per_microsecond = F_CPU / 1000000;
+// reading CCOUNT takes a single instruction
+constexpr uint32_t yield_clock_stride = 1;
+#else
+// the host stand-in for the cycle counter counts nanoseconds, and reading it is much slower
+constexpr uint32_t yield_cycles_per_microsecond = 1000;
+constexpr uint32_t yield_clock_stride = 64;
+#endif
+
+// Default budgets, well below the watchdog timeout and the time that the audio buffers last.
+inline std::array<uint32_t, yield_subsystem_count> yield_budgets {
+	1000 * yield_cycles_per_microsecond,
+	2000 * yield_cycles_per_microsecond,
+	2000 * yield_cycles_per_microsecond,
+};
+inline std::array<YieldStats, yield_subsystem_count> yield_stats {};
+
+inline void set_yield_budget(YieldSubsystem subsystem, uint32_t microseconds)
+{
+	yield_budgets[static_cast<size_t>(subsystem)] = microseconds * yield_cycles_per_microsecond;
+}
+
+inline YieldStats const& yield_stats_for(YieldSubsystem subsystem)
+{
+	return yield_stats[static_cast<size_t>(subsystem)];
+}
+
+ALWAYS_INLINE uint32_t yield_cycle_count()
+{
+#ifdef ESP8266
+	return esp_get_cycle_count();
+#else
+	return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+// Replaces unconditional yield() calls in long computations: check() reads the cycle counter, which costs about a cycle
+// on the ESP8266, and only yields once the subsystem's budget has passed since the last yield (or the start of the computation).
+// The statistics are updated once, when the budget goes out of scope.
+class YieldBudget {
+public:
+	explicit YieldBudget(YieldSubsystem subsystem)
+		: subsystem(subsystem)
+		, budget(yield_budgets[static_cast<size_t>(subsystem)])
+		, last_yield(yield_cycle_count())
+	{
+	}
+
+	~YieldBudget()
+	{
+		auto& stats = yield_stats[static_cast<size_t>(subsystem)];
+		stats.checks += checks;
+		stats.yields += yields;
+	}
+
+	YieldBudget(YieldBudget const&) = delete;
+	YieldBudget& operator=(YieldBudget const&) = delete;
+
+	ALWAYS_INLINE void check()
+	{
+		++checks;
+		if (checks % yield_clock_stride != 0)
+			return;
+		// wraps around correctly, since budgets are far below 2^32 cycles
+		if (yield_cycle_count() - last_yield < budget)
+			return;
+		yield();
+		++yields;
+		last_yield = yield_cycle_count();
+	}
+
+private:
+	YieldSubsystem subsystem;
+	uint32_t budget;
+	uint32_t last_yield;
+	uint32_t checks { 0 };
+	uint32_t yields { 0 };
+};
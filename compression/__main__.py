@@ -11,6 +11,7 @@ import numpy as np
 import struct
 from typing import Iterable, Tuple, TypeVar
 from bits import encode_leb, encode_rice, BitStream
+import turtle
 from turtle import encode_turtle
 
 target_height = 64
@@ -19,6 +20,41 @@ ms_per_frame = (1 / fps) * 1000
 
 x_block_size = 80
 y_block_size = 64
+# frame width that fills the entire display; the default width letterboxes 4:3 videos
+full_screen_width = 128
+
+# SRLV video container, see "Video Format" in Documentation/SRLV.md
+srlv_container_version = 1
+srlv_header_size = 24
+srlv_index_entry_size = 8
+srlv_keyframe_flag = 1 << 0
+srlv_repeat_flag = 1 << 1
+srlv_shared_flag = 1 << 2
+srlv_row_streamable_flag = 1 << 0
+srlv_checksum_flag = 1 << 1
+srlv_audio_flag = 1 << 2
+srlv_audio_header_size = 16
+srlv_audio_chunk_entry_size = 8
+srlv_audio_format_flac = b"fLaC"
+# encoder numbers of modes that depend on the previous frame
+delta_encoders = {1, 4}
+# encoder numbers of modes that decoders can produce a few rows at a time
+row_streamable_encoders = {0, 2, 3, 5}
+# maximum number of frames between keyframes, which limits how many frames players have to decode when skipping frames
+max_keyframe_distance = 2 * fps
+# Estimated decode time of a block per encoder number, as (base nanoseconds, nanoseconds per byte including the encoder
+# number byte). Calibrated with the "decode cost model" that tiff_test prints, over its video and a Turtle-heavy encode.
+# Garbagémon snake never won in those, so it's estimated as garbagémon plus the snake reshuffling that nibble snake pays.
+# The values are host times; the ESP8266 is several hundred times slower, but in roughly the same proportions.
+decode_cost_model: dict[int, tuple[float, float]] = {
+    0: (300.0, 13.0),
+    1: (0.0, 18.0),
+    2: (2000.0, 10.0),
+    3: (100.0, 12.0),
+    4: (420.0, 12.0),
+    5: (1500.0, 12.0),
+    6: (4100.0, 70.0),
+}
 
 
 def reverse_mask(x):
@@ -309,15 +345,20 @@ def encode_garbagémon(data: bytes) -> bytes:
 T = TypeVar("T")
 
 
-def encode_block(
+def estimate_decode_time(encoder_number: int, size: int) -> float:
+    """Estimated decode time in nanoseconds of a block with the given encoder number and size (including the encoder number byte)."""
+    base, per_byte = decode_cost_model[encoder_number]
+    return base + per_byte * size
+
+
+def encode_block_candidates(
     block: Image.Image,
     previous_block: Image.Image,
-    encoder_counts: list[int],
-    k_counts: list[int],
     delta_counts: dict[int, int],
     distance_counts: dict[int, int],
     frame: int,
-) -> bytes:
+) -> list[bytes]:
+    """Encodes the block with every encoder, without the encoder number byte; the list index is the encoder number."""
     block_data = bytes(reverse_mask(byte) for byte in block.tobytes())
     # do zig-zag or snaking encoding of the block data, which may generate longer stretches of the same color
     block_data_snake = bytes(
@@ -369,35 +410,68 @@ def encode_block(
     # rice_snake_compressed, k_rice_snake = encode_rice(
     #     encode_rle_unbounded(block_data_snake)
     # )
+    return [
+        nibble_compressed,
+        nibble_compressed_delta,
+        nibble_snake_compressed,
+        # nibble_snake_compressed_delta,
+        # leb_compressed,
+        # leb_snake_compressed,
+        garbagémon_compressed,
+        garbagémon_compressed_delta,
+        garbagémon_snake_compressed,
+        # pokémon_compressed,
+        # pokémon_compressed_delta,
+        # pokémon_snake_compressed,
+        # rice_compressed,
+        # rice_compressed_delta,
+        # rice_snake_compressed,
+        # block_data,
+        turtle_compressed,
+    ]
+
+
+def encode_block(
+    block: Image.Image,
+    previous_block: Image.Image,
+    encoder_counts: list[int],
+    k_counts: list[int],
+    delta_counts: dict[int, int],
+    distance_counts: dict[int, int],
+    frame: int,
+    allow_delta: bool,
+    row_streamable: bool,
+    decode_time_weight: float,
+    max_decode_time: float | None,
+) -> bytes:
+    """
+    Encodes the block with the encoder that minimizes size + decode_time_weight * estimated decode time in microseconds;
+    ties go to the faster encoder. Encoders whose estimate exceeds max_decode_time (in microseconds) are only used
+    if no encoder stays within it.
+    """
     # Pick best compressor. In the case that they are equal, pick fast compressor.
-    compressed_image_data: bytes
-    compressed_size: int = 100000000000000000
-    compressed_encoder_number: int = 0
+    candidates: list[tuple[int, bytes, float]] = []
     for i, data in enumerate(
-        [
-            nibble_compressed,
-            nibble_compressed_delta,
-            nibble_snake_compressed,
-            # nibble_snake_compressed_delta,
-            # leb_compressed,
-            # leb_snake_compressed,
-            garbagémon_compressed,
-            garbagémon_compressed_delta,
-            garbagémon_snake_compressed,
-            # pokémon_compressed,
-            # pokémon_compressed_delta,
-            # pokémon_snake_compressed,
-            # rice_compressed,
-            # rice_compressed_delta,
-            # rice_snake_compressed,
-            # block_data,
-            turtle_compressed,
-        ]
+        encode_block_candidates(block, previous_block, delta_counts, distance_counts, frame)
     ):
-        if len(data) < compressed_size:
-            compressed_encoder_number = i
-            compressed_image_data = data
-            compressed_size = len(data)
+        if i in delta_encoders and not allow_delta:
+            continue
+        if row_streamable and i not in row_streamable_encoders:
+            continue
+        candidates.append((i, data, estimate_decode_time(i, len(data) + 1) / 1000))
+    if max_decode_time is not None and any(
+        decode_time <= max_decode_time for _, _, decode_time in candidates
+    ):
+        candidates = [
+            candidate for candidate in candidates if candidate[2] <= max_decode_time
+        ]
+    compressed_encoder_number, compressed_image_data, _ = min(
+        candidates,
+        key=lambda candidate: (
+            len(candidate[1]) + decode_time_weight * candidate[2],
+            candidate[2],
+        ),
+    )
 
     encoder_counts[compressed_encoder_number] += 1
     # k_counts[k_rice] += 1
@@ -408,6 +482,103 @@ def encode_block(
     return bytes([compressed_encoder_number]) + compressed_image_data
 
 
+def write_srlv_container(
+    output: Path,
+    width: int,
+    height: int,
+    frame_rate: tuple[int, int],
+    frame_data: list[bytes],
+    keyframes: list[bool],
+    repeats: list[bool],
+    row_streamable: bool,
+    audio: bytes | None = None,
+):
+    """
+    Writes an SRLV video file. Frames with identical data share their data in the file.
+    Frame rate is given as a fraction (numerator, denominator).
+    Repeated frames look exactly like their previous frame.
+    FLAC audio is split into one chunk per second of video, each stored right before that second's frames.
+    """
+    frames_per_chunk = max(1, round(frame_rate[0] / frame_rate[1]))
+    chunk_count = (
+        max(1, (len(frame_data) + frames_per_chunk - 1) // frames_per_chunk)
+        if audio is not None
+        else 0
+    )
+    audio_header_size = srlv_audio_header_size if audio is not None else 0
+    index_offset = srlv_header_size + audio_header_size
+    audio_index_offset = index_offset + srlv_index_entry_size * len(frame_data)
+    data_offset = audio_index_offset + srlv_audio_chunk_entry_size * chunk_count
+
+    index = bytearray()
+    audio_index = bytearray()
+    data = bytearray()
+    offset_for_data: dict[bytes, int] = {}
+    references: dict[bytes, int] = defaultdict(int)
+    for frame in frame_data:
+        references[frame] += 1
+    for frame_number, (frame, is_keyframe, is_repeat) in enumerate(
+        zip(frame_data, keyframes, repeats)
+    ):
+        if audio is not None and frame_number % frames_per_chunk == 0:
+            # split evenly by size; FLAC frames may straddle chunks, since players read the chunks as one stream
+            chunk = frame_number // frames_per_chunk
+            chunk_data = audio[
+                len(audio) * chunk // chunk_count : len(audio) * (chunk + 1) // chunk_count
+            ]
+            audio_index += struct.pack("<II", data_offset + len(data), len(chunk_data))
+            data += chunk_data
+        if frame not in offset_for_data:
+            offset_for_data[frame] = data_offset + len(data)
+            data += frame
+        flags = 0
+        if is_keyframe:
+            flags |= srlv_keyframe_flag
+            # players cache decoded shared keyframes
+            if references[frame] > 1:
+                flags |= srlv_shared_flag
+        if is_repeat:
+            flags |= srlv_repeat_flag
+        index += struct.pack("<IHBx", offset_for_data[frame], len(frame), flags)
+    if audio is not None and not frame_data:
+        audio_index += struct.pack("<II", data_offset, len(audio))
+        data += audio
+
+    flags = srlv_checksum_flag
+    if row_streamable:
+        flags |= srlv_row_streamable_flag
+    if audio is not None:
+        flags |= srlv_audio_flag
+    max_frame_size = max((len(frame) for frame in frame_data), default=0)
+    header = b"SRLV" + struct.pack(
+        "<BBHHHHHII",
+        srlv_container_version,
+        flags,
+        width,
+        height,
+        frame_rate[0],
+        frame_rate[1],
+        max_frame_size,
+        len(frame_data),
+        index_offset,
+    )
+    assert len(header) == srlv_header_size
+    if audio is not None:
+        header += srlv_audio_format_flac + struct.pack(
+            "<III", chunk_count, audio_index_offset, len(audio)
+        )
+    contents = header + index + audio_index + data
+    output.write_bytes(contents + struct.pack("<I", srlv_checksum(contents)))
+
+
+def srlv_checksum(data: bytes) -> int:
+    """32-bit FNV-1a hash, which players use to validate files once before decoding them without bounds checks."""
+    checksum = 2166136261
+    for byte in data:
+        checksum = ((checksum ^ byte) * 16777619) & 0xFFFFFFFF
+    return checksum
+
+
 def make_self_delta(image: Image.Image) -> Image.Image:
     image_bytes = image.convert(mode="L").tobytes()
     delta_bytes = bytearray()
@@ -422,7 +593,13 @@ def make_self_delta(image: Image.Image) -> Image.Image:
     return deltas
 
 
-def encode(input: Path):
+def encode(
+    input: Path,
+    row_streamable: bool,
+    audio: Path | None,
+    decode_time_weight: float,
+    max_decode_time: float | None,
+):
     video = cv2.VideoCapture(str(input))
     success, image_data = video.read()
     video_fps = video.get(cv2.CAP_PROP_FPS)
@@ -431,6 +608,15 @@ def encode(input: Path):
     output_frame_count = video_seconds * fps
 
     frame_references: list[str] = []
+    container_frames: list[bytes] = []
+    container_keyframes: list[bool] = []
+    container_repeats: list[bool] = []
+    # keyframe data of every picture that was encoded as a keyframe, for reuse by identical frames
+    keyframe_for_picture: dict[bytes, bytes] = {}
+    # estimated decode time of every frame in microseconds
+    frame_decode_times: list[float] = []
+    decode_time_for_keyframe: dict[bytes, float] = {}
+    last_picture: bytes | None = None
     frame_c_arrays = ""
     name_for_frame: dict[bytes, str] = {}
 
@@ -446,6 +632,7 @@ def encode(input: Path):
 
     success = True
     last_frame: Image.Image | None = None
+    last_keyframe = 0
     x_blocks: int = 1
     y_blocks: int = 1
     while success:
@@ -455,13 +642,16 @@ def encode(input: Path):
             break
         image: Image.Image = Image.fromarray(image_data)
         width, height = image.size
-        height_scale = height / target_height
-        image = image.resize((int(width / height_scale), int(target_height))).convert(
-            mode="1"
-        )
+        # scale so that the frame is covered entirely, and crop the excess evenly
+        scale = max(x_block_size / width, target_height / height)
+        scaled_width = max(int(width * scale), x_block_size)
+        scaled_height = max(int(height * scale), target_height)
+        image = image.resize((scaled_width, scaled_height)).convert(mode="1")
+        left = (scaled_width - x_block_size) // 2
+        top = (scaled_height - target_height) // 2
+        image = image.crop((left, top, left + x_block_size, top + target_height))
         x_blocks = floor(image.size[0] / x_block_size)
         y_blocks = floor(image.size[1] / y_block_size)
-        image = image.crop((0, 0, x_blocks * x_block_size, y_blocks * y_block_size))
         image_binary = bytes(reverse_mask(byte) for byte in image.tobytes())
 
         array_name = f"frame_{count}"
@@ -478,7 +668,16 @@ def encode(input: Path):
 
         # split image up into macroblocks
         compressed_image_data = bytearray()
-        for x_index, y_index in product(range(x_blocks), range(y_blocks)):
+        decode_time = 0.0
+        is_keyframe = True
+        allow_delta = last_frame is not None and count - last_keyframe < max_keyframe_distance
+        # identical keyframes share their data, which players can cache
+        reused_keyframe = keyframe_for_picture.get(image_binary)
+        if reused_keyframe is not None:
+            compressed_image_data += reused_keyframe
+            decode_time = decode_time_for_keyframe[reused_keyframe]
+        blocks = product(range(x_blocks), range(y_blocks)) if reused_keyframe is None else []
+        for x_index, y_index in blocks:
             # print(count, x_index, y_index)
             box = (
                 x_index * x_block_size,
@@ -490,7 +689,8 @@ def encode(input: Path):
             if last_frame is not None:
                 previous_block = last_frame.crop(box)
             else:
-                previous_block = block
+                # decoders start out with a black frame
+                previous_block = Image.new(mode="1", size=block.size, color=0)
             print(f"### frame {count}")
             encoded_block = encode_block(
                 block,
@@ -500,8 +700,19 @@ def encode(input: Path):
                 delta_counts,
                 distance_counts,
                 count,
+                allow_delta,
+                row_streamable,
+                decode_time_weight,
+                max_decode_time / (x_blocks * y_blocks)
+                if max_decode_time is not None
+                else None,
             )
             compressed_image_data += encoded_block
+            decode_time += (
+                estimate_decode_time(encoded_block[0], len(encoded_block)) / 1000
+            )
+            if encoded_block[0] in delta_encoders:
+                is_keyframe = False
 
         c_array = bytes_to_c_array(compressed_image_data, array_name)
         # disable frame reuse since interframe compression messes with it.
@@ -513,6 +724,15 @@ def encode(input: Path):
         else:
             reuse_count += 1
         frame_references.append(name_for_frame[bytes(compressed_image_data)])
+        container_frames.append(bytes(compressed_image_data))
+        container_keyframes.append(is_keyframe)
+        container_repeats.append(image_binary == last_picture)
+        frame_decode_times.append(decode_time)
+        if is_keyframe:
+            last_keyframe = count
+            keyframe_for_picture.setdefault(image_binary, bytes(compressed_image_data))
+            decode_time_for_keyframe[bytes(compressed_image_data)] = decode_time
+        last_picture = image_binary
 
         # if count == 42:
         #     raise Exception()
@@ -574,6 +794,7 @@ def encode(input: Path):
     print(
         f"{binary_size} bytes compressed, {raw_size} bytes raw, {binary_size / raw_size * 100:.1f}%"
     )
+    print_decode_time_report(frame_decode_times, max_decode_time)
     frame_reference_c_array = f"static unsigned char* frames[] PROGMEM = {{ {', '.join(frame_references)} }};\n"
     frame_sizes = f"static size_t frame_sizes[] PROGMEM = {{ {', '.join(f'sizeof({reference})' for reference in frame_references)} }};\n"
     output = Path("bad_apple.h")
@@ -581,6 +802,40 @@ def encode(input: Path):
         frame_c_arrays + "\n" + frame_reference_c_array + "\n" + frame_sizes,
         encoding="utf-8",
     )
+    write_srlv_container(
+        input.with_suffix(".srlv"),
+        x_blocks * x_block_size,
+        y_blocks * y_block_size,
+        (fps, 1),
+        container_frames,
+        container_keyframes,
+        container_repeats,
+        row_streamable,
+        audio.read_bytes() if audio is not None else None,
+    )
+
+
+def print_decode_time_report(frame_decode_times: list[float], max_decode_time: float | None):
+    """Reports the estimated decode times, whose worst case bounds the CPU time that players have to reserve per frame."""
+    if not frame_decode_times:
+        return
+    sorted_times = sorted(frame_decode_times)
+    worst_frame = max(range(len(frame_decode_times)), key=lambda frame: frame_decode_times[frame])
+    print(
+        f"estimated decode time per frame: {sum(sorted_times) / len(sorted_times):.1f} µs mean, "
+        f"{sorted_times[len(sorted_times) // 2]:.1f} µs p50, {sorted_times[int(0.99 * (len(sorted_times) - 1))]:.1f} µs p99, "
+        f"{sorted_times[-1]:.1f} µs worst (frame {worst_frame})"
+    )
+    if max_decode_time is not None:
+        over_budget = sum(1 for time in frame_decode_times if time > max_decode_time)
+        print(f"{over_budget} frames over the {max_decode_time:.1f} µs budget")
+
+
+def set_frame_width(width: int):
+    """Players only support the letterboxed and the full screen width, see Documentation/SRLV.md."""
+    global x_block_size
+    x_block_size = width
+    turtle.x_size = width
 
 
 def main():
@@ -588,8 +843,42 @@ def main():
         description="Encode video to TIFF CCITT Group 4 images"
     )
     parser.add_argument("input", type=Path, help="Input file")
+    parser.add_argument(
+        "--row-streamable",
+        action="store_true",
+        help="Only use compression methods that players can decode a few rows at a time with little memory. Increases size.",
+    )
+    parser.add_argument(
+        "--full-screen",
+        action="store_true",
+        help=f"Encode {full_screen_width}x{target_height} frames that fill the entire display, cropping the video as needed.",
+    )
+    parser.add_argument(
+        "--audio",
+        type=Path,
+        help="FLAC file to interleave with the frames, so that players can play audio and video from a single file.",
+    )
+    parser.add_argument(
+        "--decode-time-weight",
+        type=float,
+        default=0.0,
+        help="Bytes that a slower encoding has to save per microsecond of extra estimated decode time (host time, see decode_cost_model). 0 picks the smallest encoding.",
+    )
+    parser.add_argument(
+        "--max-decode-time",
+        type=float,
+        help="Estimated decode time budget per frame in microseconds; encodings over it are only used if nothing else fits.",
+    )
     args = parser.parse_args()
-    encode(args.input)
+    if args.full_screen:
+        set_frame_width(full_screen_width)
+    encode(
+        args.input,
+        args.row_streamable,
+        args.audio,
+        args.decode_time_weight,
+        args.max_decode_time,
+    )
 
 
 if __name__ == "__main__":
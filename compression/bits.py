@@ -61,6 +61,41 @@ class BitStream:
         self.write_bits(value, leading_bits)
 
 
+@dataclass
+class BitReader:
+    """Reads bits in the same MSB-first order that BitStream writes them."""
+
+    data: bytes
+    next_bit: int = field(default=0, init=False)
+
+    def bits_left(self) -> int:
+        return len(self.data) * 8 - self.next_bit
+
+    def read_bit(self) -> int:
+        if self.bits_left() <= 0:
+            raise EOFError("read past end of bit stream")
+        byte = self.data[self.next_bit // 8]
+        bit = (byte >> (7 - self.next_bit % 8)) & 1
+        self.next_bit += 1
+        return bit
+
+    def read_bits(self, count: int) -> int:
+        output = 0
+        for _ in range(count):
+            output = (output << 1) | self.read_bit()
+        return output
+
+    def read_rice(self, k: int) -> int:
+        """Inverse of BitStream.write_rice."""
+        msbs = 0
+        while self.read_bit() == 0:
+            msbs += 1
+        return (msbs << k) | self.read_bits(k)
+
+    def align_to_byte_boundary(self):
+        self.next_bit = (self.next_bit + 7) // 8 * 8
+
+
 def encode_rice(data: list[int]) -> tuple[bytes, int]:
     """
     Rice / Exponential Golomb coding for variable length integers.
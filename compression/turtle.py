@@ -10,7 +10,7 @@ from functools import reduce
 from typing import Optional, Self, TypeVar
 from enum import Enum
 from dataclasses import dataclass, field
-from bits import BitStream
+from bits import BitReader, BitStream
 import numpy as np
 from itertools import product
 from PIL import Image
@@ -18,6 +18,13 @@ from PIL import Image
 x_size = 80
 y_size = 64
 
+# Huffman table entries only have 5 bits available for the code.
+max_code_length = 5
+# Table entry for commands that are not used in a frame; its bit size of 8 is otherwise illegal.
+unused_table_entry = 0xFF
+# Marks the end of the object list, since object headers never have the MSB set.
+single_pixel_trailer_marker = 0x80
+
 
 # reached a dead end
 class DeadendException(Exception):
@@ -113,9 +120,22 @@ class HuffmanTable:
         self.code_table = HuffmanTable.compute_table(probabilities)
 
     @staticmethod
-    def compute_table(probabilities: dict[Command, float]) -> dict[Command, list[bool]]:
+    def compute_code_lengths(
+        probabilities: dict[Command, float],
+    ) -> dict[Command, int]:
+        # unused commands don't get a code at all
+        used = {
+            command: probability
+            for command, probability in probabilities.items()
+            if probability > 0
+        }
+        if len(used) == 0:
+            return {}
+        if len(used) == 1:
+            return {command: 1 for command in used}
+
         trees: list[HuffmanTreeNode] = []
-        for command, probability in probabilities.items():
+        for command, probability in used.items():
             trees.append(HuffmanTreeNode.new_leaf(probability, command))
 
         while len(trees) > 1:
@@ -125,12 +145,55 @@ class HuffmanTable:
             trees.append(HuffmanTreeNode.new_inner(lowest, second_lowest))
 
         tree = trees[0]
+        lengths = {
+            command: len(tree.bit_sequence_for(command) or []) for command in used
+        }
+
+        # Limit code lengths so that the codes fit into the table entries.
+        # Clamping breaks the Kraft inequality, so lengthen the longest codes that can still grow until it holds again.
+        lengths = {
+            command: min(length, max_code_length) for command, length in lengths.items()
+        }
+        while sum(2 ** -length for length in lengths.values()) > 1:
+            growable = [
+                command for command, length in lengths.items() if length < max_code_length
+            ]
+            longest = max(growable, key=lambda command: (lengths[command], -used[command]))
+            lengths[longest] += 1
+        return lengths
 
+    @staticmethod
+    def compute_table(probabilities: dict[Command, float]) -> dict[Command, list[bool]]:
+        """Computes canonical Huffman codes, which only depend on the code lengths."""
+        lengths = HuffmanTable.compute_code_lengths(probabilities)
+        command_order = list(Command)
         table: dict[Command, list[bool]] = {}
-        for command in Command:
-            table[command] = tree.bit_sequence_for(command) or []
+        code = 0
+        last_length = 0
+        for command in sorted(
+            lengths.keys(), key=lambda command: (lengths[command], command_order.index(command))
+        ):
+            length = lengths[command]
+            code <<= length - last_length
+            table[command] = [bool(code & (1 << bit)) for bit in reversed(range(length))]
+            code += 1
+            last_length = length
         return table
 
+    def table_bytes(self) -> bytes:
+        """Huffman table as stored in the frame header, see SRLV.md."""
+        output = bytearray()
+        for command in Command:
+            code = self.code_table.get(command)
+            if code is None:
+                output.append(unused_table_entry)
+                continue
+            value = 0
+            for bit in code:
+                value = (value << 1) | int(bit)
+            output.append(((len(code) - 1) << 5) | value)
+        return output
+
     def write_command(self, stream: BitStream, command: Command):
         for bit in self.code_table[command]:
             stream.write_bits(int(bit), 1)
@@ -401,9 +464,14 @@ def fill_object_poly(
     start_x: int,
     start_y: int,
     object_commands: list[tuple[Command, int]],
-    edge: np.array,
+    shape: tuple[int, int],
 ) -> np.array:
-    filled = edge.copy()
+    """
+    Returns all pixels covered by an object: its edge, i.e. every pixel the turtle moves over, and its even-odd filled interior.
+    This must only depend on the encoded commands, since the decoder has nothing else to go on.
+    """
+    filled = np.zeros(shape=shape, dtype=bool)
+    filled[start_x, start_y] = True
 
     # find first pixel to the right of the edge that is not covered
     current_direction = 1
@@ -415,9 +483,11 @@ def fill_object_poly(
     max_x, max_y = (-1000000,) * 2
     for command, dist in object_commands:
         current_direction = (current_direction + command.direction_delta()) % 8
-        current_x, current_y = move_in_direction(
-            current_direction, current_x, current_y, dist
-        )
+        for _ in range(dist):
+            current_x, current_y = move_in_direction(
+                current_direction, current_x, current_y
+            )
+            filled[current_x, current_y] = True
         min_x = min(min_x, current_x)
         min_y = min(min_y, current_y)
         max_x = max(max_x, current_x)
@@ -459,6 +529,8 @@ def encode_turtle(
 
     # image copy with all currently present objects, will be gradually filled up
     blitted = np.zeros_like(image)
+    # only the objects, which is what the decoder will draw before the single-pixel trailer
+    drawn = np.zeros_like(image)
     single_pixels = np.zeros_like(image)
     deadend_pixels = np.zeros_like(image)
     last_used_pixel = None
@@ -497,7 +569,7 @@ def encode_turtle(
                 source, found_x, found_y
             )
             # fill object edge
-            filled = fill_object_poly(found_x, found_y, object_commands, edge)
+            filled = fill_object_poly(found_x, found_y, object_commands, image.shape)
             # for y, x in product(range(y_size), range(x_size)):
             #     if deadends[x, y]:
             #         debug_image.putpixel(
@@ -515,6 +587,7 @@ def encode_turtle(
             #     print(f"super short commands from {found_x}, {found_y}:", object_commands)
             # copy filled surface to blitted
             blitted ^= filled
+            drawn ^= filled
             # discard deadends temporarily (for this pixel)
             # todo: probably useless
             deadend_pixels |= deadends
@@ -544,6 +617,10 @@ def encode_turtle(
         # HACK: return lots of data to make the encoder choose something else
         return bytes(1024 * 32)
 
+    # blitted may still contain flipped deadend pixels that the decoder knows nothing about,
+    # so the single pixels are whatever the objects didn’t get right.
+    single_pixels = image ^ drawn
+
     command_occurrences = reduce(
         sum_occurrences,
         (obj.command_occurrences() for obj in objects),
@@ -556,6 +633,10 @@ def encode_turtle(
     # print(command_table)
 
     stream = BitStream()
+    # header: info byte (never inverted) and Huffman table
+    stream.write_bits(0, 8)
+    for entry in command_table.table_bytes():
+        stream.write_bits(entry, 8)
     for obj in objects:
         obj.write(stream, command_table, distance_hist)
 
@@ -566,13 +647,16 @@ def encode_turtle(
             single_pixel_list.append((x, y))
 
     if len(single_pixel_list) > 0:
+        stream.write_bits(single_pixel_trailer_marker, 8)
         current_pixel = single_pixel_list.pop()
         stream.write_bits(current_pixel[0], 8)
         stream.write_bits(current_pixel[1], 8)
         while len(single_pixel_list) > 0:
+            # nearest pixel last, so that it is popped next
             single_pixel_list.sort(
                 key=lambda px: abs(current_pixel[0] - px[0])
-                + abs(current_pixel[1] - px[1])
+                + abs(current_pixel[1] - px[1]),
+                reverse=True,
             )
             next_x, next_y = single_pixel_list.pop()
             dx, dy = current_pixel[0] - next_x, current_pixel[1] - next_y
@@ -586,9 +670,97 @@ def encode_turtle(
             current_pixel = (next_x, next_y)
 
     stream.write_to_byte_boundary()
+
+    if decode_turtle(stream.data) != bytes(data):
+        print("warning: turtle frame doesn’t decode correctly, discarding.")
+        return bytes(1024 * 32)
     return stream.data
 
 
+def decode_turtle(data: bytes) -> bytes:
+    """Reference decoder, returns the frame in XBM format. See SRLV.md for the format."""
+    image = np.zeros(shape=(x_size, y_size), dtype=bool)
+    reader = BitReader(bytes(data))
+
+    info = reader.read_bits(8)
+    inverted = (info & 0x80) > 0
+    # map from (code length, code) to command
+    codes: dict[tuple[int, int], Command] = {}
+    for command in Command:
+        entry = reader.read_bits(8)
+        if entry == unused_table_entry:
+            continue
+        length = (entry >> 5) + 1
+        codes[(length, entry & ((1 << length) - 1))] = command
+
+    def read_command() -> Command:
+        length, code = 0, 0
+        while length < max_code_length:
+            code = (code << 1) | reader.read_bit()
+            length += 1
+            if (length, code) in codes:
+                return codes[(length, code)]
+        raise ValueError("invalid Huffman code")
+
+    try:
+        while reader.bits_left() >= 16:
+            start_x = reader.read_bits(8)
+            if start_x == single_pixel_trailer_marker:
+                break
+            start_y = reader.read_bits(8)
+            x, y, direction = start_x, start_y, 1
+            commands: list[tuple[Command, int]] = []
+            while True:
+                command = read_command()
+                direction = (direction + command.direction_delta()) % 8
+                dist = 1
+                if command == Command.ForwardN:
+                    dist = reader.read_rice(2) + 1
+                elif command == Command.ForwardMany:
+                    dist = 0
+                    while (x, y) != (start_x, start_y) or dist == 0:
+                        next_x, next_y = move_in_direction(direction, x, y)
+                        if not (0 <= next_x < x_size and 0 <= next_y < y_size):
+                            break
+                        x, y = next_x, next_y
+                        dist += 1
+                    commands.append((Command.Forward1, dist))
+                    if (x, y) == (start_x, start_y):
+                        break
+                    continue
+                x, y = move_in_direction(direction, x, y, dist)
+                commands.append((command, dist))
+                if (x, y) == (start_x, start_y):
+                    break
+            image ^= fill_object_poly(start_x, start_y, commands, image.shape)
+            reader.align_to_byte_boundary()
+        else:
+            return _image_to_xbm(image, inverted)
+
+        x, y = reader.read_bits(8), reader.read_bits(8)
+        image[x, y] ^= True
+        while True:
+            dx, dy = reader.read_rice(5), reader.read_rice(5)
+            x -= (dx - 1) // 2 if dx % 2 == 1 else -(dx // 2)
+            y -= (dy - 1) // 2 if dy % 2 == 1 else -(dy // 2)
+            image[x, y] ^= True
+    except EOFError:
+        pass
+    return _image_to_xbm(image, inverted)
+
+
+def _image_to_xbm(image: np.array, inverted: bool) -> bytes:
+    output = bytearray()
+    for y in range(y_size):
+        for x_byte in range(x_size // 8):
+            byte = 0
+            for bit in range(8):
+                if image[x_byte * 8 + bit, y] != inverted:
+                    byte |= 1 << bit
+            output.append(byte)
+    return output
+
+
 if __name__ == "__main__":
     table = HuffmanTable(
         {
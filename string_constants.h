@@ -124,6 +124,7 @@ static const char* debugging_label PROGMEM = "Firmware-Debugging\naktivieren";
 static const char* auto_disable_label PROGMEM = "Bildschirm abschalten\nbei Inaktivität";
 static const char* confirm_delete_label PROGMEM = "Wirklich löschen?";
 static const char* confirm_move_label PROGMEM = "Wirklich hierher\nverschieben?";
+static const char* video_missing_label PROGMEM = "Video nicht gefunden\noder ungültig";
 static const char* date_settings_label PROGMEM = "Datumsanzeige auf dem\nUhrenbildschirm";
 
 static char const* twelve_hour_format PROGMEM = "12 Stunden";
@@ -0,0 +1,341 @@
+// Tests of the audio pipeline's building blocks and of reading videos from the card, separate from the decoder benchmarks so that neither blocks the other.
+
+#include <AudioFileSourceSdFs.h>
+#include <GainStage.h>
+#include <PcmRingBuffer.h>
+#include <SRLVAudioSource.h>
+#include <SRLVFile.h>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Not a multiple of the sector size, so that the last sector is only partly file data.
+constexpr uint32_t SD_TEST_FILE_SIZE = 60000 + 123;
+// random reads and seeks per read-ahead source test
+constexpr int SD_TEST_OPERATIONS = 20000;
+
+// Reports every failed check of a test instead of stopping at the first one.
+class Checks {
+public:
+	explicit Checks(char const* test_name)
+		: test_name(test_name)
+	{
+	}
+
+	void operator()(bool condition, char const* what)
+	{
+		if (!condition)
+			std::cout << test_name << ": " << what << " failed" << std::endl;
+		ok = ok && condition;
+	}
+
+	// Prints the test's result and returns whether all checks passed.
+	bool report() const
+	{
+		std::cout << test_name << ": " << (ok ? "ok" : "broken") << std::endl;
+		return ok;
+	}
+
+private:
+	char const* test_name;
+	bool ok { true };
+};
+
+// Returns whether the PCM ring buffer keeps samples in order through wraparounds, also with the consumer on another thread.
+bool verify_pcm_ring()
+{
+	constexpr uint32_t capacity = 64;
+	constexpr uint32_t stress_samples = 1 << 20;
+	// static since the consumer thread spins on it
+	static PcmRingBuffer<capacity> ring;
+	ring.clear();
+	Checks check("pcm ring");
+
+	uint32_t sample = 0;
+	check(!ring.pop(sample) && ring.size() == 0, "empty pop");
+	for (uint32_t i = 0; i < capacity; ++i)
+		ring.push(i);
+	check(!ring.push(capacity) && ring.size() == capacity && ring.free_space() == 0, "full push");
+	check(ring.peek(sample) && sample == 0 && ring.size() == capacity, "peek");
+	// push and pop at a fill level of half the capacity for a few wraparounds
+	for (uint32_t i = 0; i < capacity / 2; ++i)
+		ring.pop(sample);
+	auto in_order = true;
+	for (uint32_t i = capacity; i < capacity * 5; ++i)
+		in_order = in_order && ring.push(i) && ring.pop(sample) && sample == i - capacity / 2;
+	check(in_order && ring.size() == capacity / 2, "wraparound");
+	ring.clear();
+	check(ring.size() == 0 && !ring.peek(sample), "clear");
+
+	// the consumer drops samples only after peeking them
+	uint32_t consumer_errors = 0;
+	std::thread consumer([&] {
+		uint32_t expected = 0;
+		while (expected < stress_samples) {
+			uint32_t value;
+			if (!ring.peek(value)) {
+				std::this_thread::sleep_for(std::chrono::microseconds(1));
+				continue;
+			}
+			consumer_errors += value != expected;
+			ring.drop();
+			++expected;
+		}
+	});
+	for (uint32_t i = 0; i < stress_samples;) {
+		if (ring.push(i))
+			++i;
+		else
+			std::this_thread::sleep_for(std::chrono::microseconds(1));
+	}
+	consumer.join();
+	check(consumer_errors == 0 && ring.size() == 0, "threaded stress");
+	return check.report();
+}
+
+// Returns whether the gain stage passes samples unchanged at unity gain and fades in steadily to the volume with every curve.
+bool verify_gain_stage()
+{
+	Checks check("gain stage");
+
+	GainStage gain;
+	auto passes_unchanged = true;
+	for (int32_t value = -32768; value < 32768; value += 7) {
+		int16_t sample[2] = { static_cast<int16_t>(value), static_cast<int16_t>(-1 - value) };
+		gain.apply(sample);
+		gain.advance();
+		passes_unchanged = passes_unchanged && sample[0] == value && sample[1] == -1 - value;
+	}
+	check(passes_unchanged, "unity gain");
+
+	gain.set_volume(GainStage::volume_from_percent(50));
+	for (uint32_t i = 0; i < 2 * GAIN_BLOCK_SAMPLES; ++i)
+		gain.advance();
+	int16_t half[2] = { 20000, -20000 };
+	gain.apply(half);
+	check(half[0] == 10000 && half[1] == -10000, "volume ramp");
+
+	for (auto const curve : { FadeCurve::Linear, FadeCurve::Quadratic, FadeCurve::Cubic, FadeCurve::SmoothStep }) {
+		gain.set_sample_rate(1000);
+		gain.start_fade({ 10, curve });
+		int16_t previous = 0;
+		auto is_steady = true;
+		for (uint32_t i = 0; i < 10 * 1000 + GAIN_BLOCK_SAMPLES; ++i) {
+			int16_t sample[2] = { 32767, -32768 };
+			gain.apply(sample);
+			gain.advance();
+			is_steady = is_steady && sample[0] >= previous && sample[0] - previous <= static_cast<int32_t>(32767 / GAIN_BLOCK_SAMPLES) + 1;
+			previous = sample[0];
+		}
+		check(is_steady && !gain.is_fading() && previous == 16383, "fade-in");
+	}
+
+	// the longest fade at 96kHz is longer than 2^32 samples and must not wrap around to a shorter one
+	gain.set_volume(UNITY_GAIN);
+	gain.set_sample_rate(96000);
+	gain.start_fade({ 0xFFFF, FadeCurve::Linear });
+	for (uint32_t i = 0; i < 1 << 20; ++i)
+		gain.advance();
+	int16_t faded[2] = { 32767, 32767 };
+	gain.apply(faded);
+	check(gain.is_fading() && faded[0] <= static_cast<int16_t>((static_cast<uint64_t>(32767) << 20) / UINT32_MAX + 1), "long fade");
+	return check.report();
+}
+
+// Reads the whole file in the odd-sized pieces a decoder asks for, then reads and seeks at random like a decoder that skips around.
+// Returns whether all data matched the file.
+bool read_like_decoder(AudioFileSourceReadAhead& source, std::vector<uint8_t> const& expected)
+{
+	std::mt19937 random(5);
+	std::vector<uint8_t> data(3000);
+	std::vector<uint8_t> stream;
+	while (true) {
+		source.fill();
+		auto const bytes_read = source.read(data.data(), random() % 700 + 1);
+		if (bytes_read == 0)
+			break;
+		stream.insert(stream.end(), data.begin(), data.begin() + bytes_read);
+	}
+	auto matches = stream == expected;
+
+	for (int i = 0; i < SD_TEST_OPERATIONS; ++i) {
+		auto const operation = random() % 3;
+		if (operation == 0) {
+			source.fill();
+		} else if (operation == 1) {
+			auto const target = static_cast<int32_t>(random() % (expected.size() + 1));
+			matches = matches && source.seek(target, SEEK_SET) && source.getPos() == static_cast<uint32_t>(target);
+		} else {
+			auto const start = source.getPos();
+			auto const length = random() % data.size() + 1;
+			auto const bytes_read = source.read(data.data(), length);
+			auto const expected_length = std::min<size_t>(length, expected.size() - start);
+			matches = matches && bytes_read == expected_length && memcmp(data.data(), expected.data() + start, bytes_read) == 0
+				&& source.getPos() == start + bytes_read;
+		}
+	}
+	return matches;
+}
+
+// Returns whether AudioFileSourceSdFs reads contiguous files straight from the card's sectors, fragmented files through the
+// file system, and falls back to the file system when a sector read fails, all without corrupting the data.
+bool verify_sd_source()
+{
+	Checks check("sd source");
+
+	std::vector<uint8_t> file_data(SD_TEST_FILE_SIZE);
+	std::mt19937 random(1);
+	for (auto& byte : file_data)
+		byte = static_cast<uint8_t>(random());
+	constexpr uint32_t sector_count = (SD_TEST_FILE_SIZE + STUB_SECTOR_SIZE - 1) / STUB_SECTOR_SIZE;
+	// other data (0xEE) around and between the files must never show up
+	SdFs card;
+	card.add_file("contiguous", file_data, { { 37, sector_count } });
+	card.add_file("fragmented", file_data, { { 200, 40 }, { 300, sector_count - 40 } });
+
+	{
+		AudioFileSourceSdFs source(card);
+		check(source.open("contiguous") && source.is_raw_mode(), "contiguous file in raw mode");
+		check(read_like_decoder(source, file_data), "contiguous data");
+		check(source.is_raw_mode() && source.read_ahead_stats().raw_reads > 0 && card.the_card.file_reads == 0, "contiguous file read raw");
+
+		// The last sector is read in full, which overwrites the oldest buffered data with what follows the file.
+		// Seeking back into the buffer must not return that.
+		source.seek(static_cast<int32_t>(SD_TEST_FILE_SIZE - 100), SEEK_SET);
+		uint8_t tail[100];
+		source.read(tail, sizeof(tail));
+		auto tail_matches = true;
+		for (uint32_t start = SD_TEST_FILE_SIZE - AUDIO_READ_AHEAD_SIZE; start < SD_TEST_FILE_SIZE; start += 61) {
+			uint8_t byte = 0;
+			tail_matches = tail_matches && source.seek(static_cast<int32_t>(start), SEEK_SET) && source.read(&byte, 1) == 1 && byte == file_data[start];
+		}
+		check(tail_matches, "buffer after reading the last sector");
+	}
+
+	{
+		card.the_card.sector_reads = 0;
+		card.the_card.failing_after = 3;
+		AudioFileSourceSdFs source(card);
+		check(source.open("contiguous") && source.is_raw_mode(), "failing file in raw mode");
+		check(read_like_decoder(source, file_data), "data after a failed sector read");
+		check(!source.is_raw_mode() && card.the_card.file_reads > 0, "fallback to the file system");
+		card.the_card.failing_after = SIZE_MAX;
+	}
+
+	{
+		card.the_card.sector_reads = 0;
+		AudioFileSourceSdFs source(card);
+		check(source.open("fragmented") && !source.is_raw_mode(), "fragmented file not in raw mode");
+		check(read_like_decoder(source, file_data), "fragmented data");
+		check(card.the_card.sector_reads == 0, "fragmented file read through the file system");
+	}
+	return check.report();
+}
+
+void append_u32(std::vector<uint8_t>& data, uint32_t value)
+{
+	for (int shift = 0; shift < 32; shift += 8)
+		data.push_back(static_cast<uint8_t>(value >> shift));
+}
+
+// Returns whether SRLVAudioSource reads the audio chunks of a video ahead and joins them into the original stream.
+bool verify_srlv_audio_source()
+{
+	Checks check("srlv audio");
+
+	std::vector<uint8_t> audio(SD_TEST_FILE_SIZE);
+	std::mt19937 random(2);
+	for (auto& byte : audio)
+		byte = static_cast<uint8_t>(random());
+	// chunks of varying sizes, with stand-in video data (0xEE) in between, like the encoder interleaves them
+	std::vector<uint32_t> chunk_sizes;
+	for (uint32_t size = 0; size < audio.size();) {
+		chunk_sizes.push_back(std::min<uint32_t>(random() % 3000 + 1, audio.size() - size));
+		size += chunk_sizes.back();
+	}
+	auto const index_offset = static_cast<uint32_t>(SRLV::video_header_size + SRLV::audio_header_size);
+	auto const chunk_count = static_cast<uint32_t>(chunk_sizes.size());
+
+	std::vector<uint8_t> file { 'S', 'R', 'L', 'V', SRLV::container_version, 1 << 2, 80, 0, 64, 0, 1, 0, 1, 0, 0, 0 };
+	append_u32(file, 0);
+	append_u32(file, index_offset);
+	file.insert(file.end(), { 'f', 'L', 'a', 'C' });
+	append_u32(file, chunk_count);
+	append_u32(file, index_offset);
+	append_u32(file, static_cast<uint32_t>(audio.size()));
+	auto chunk_offset = index_offset + chunk_count * static_cast<uint32_t>(SRLV::audio_chunk_entry_size);
+	for (auto const chunk_size : chunk_sizes) {
+		chunk_offset += 100;
+		append_u32(file, chunk_offset);
+		append_u32(file, chunk_size);
+		chunk_offset += chunk_size;
+	}
+	uint32_t audio_offset = 0;
+	for (auto const chunk_size : chunk_sizes) {
+		file.insert(file.end(), 100, 0xEE);
+		file.insert(file.end(), audio.begin() + audio_offset, audio.begin() + audio_offset + chunk_size);
+		audio_offset += chunk_size;
+	}
+
+	SdFs card;
+	card.add_file("video", file, { { 0, static_cast<uint32_t>((file.size() + STUB_SECTOR_SIZE - 1) / STUB_SECTOR_SIZE) } });
+	SRLVAudioSource source(card);
+	check(source.open("video") && source.getSize() == audio.size(), "open");
+	// the decoder's small reads come from the buffer, without touching the card
+	source.fill();
+	auto const card_reads = card.the_card.file_reads;
+	uint8_t start[100];
+	check(source.read(start, sizeof(start)) == sizeof(start) && memcmp(start, audio.data(), sizeof(start)) == 0
+			&& card.the_card.file_reads == card_reads && source.read_ahead_stats().underruns == 0,
+		"read-ahead");
+	source.seek(0, SEEK_SET);
+	check(read_like_decoder(source, audio), "audio data");
+	return check.report();
+}
+
+// Returns a video without audio whose frame index (of 8 zero bytes per frame) claims the given number of frames.
+std::vector<uint8_t> make_video(uint32_t frame_count, uint32_t index_entries)
+{
+	std::vector<uint8_t> file { 'S', 'R', 'L', 'V', SRLV::container_version, 0, 80, 0, 64, 0, 1, 0, 1, 0, 0, 1 };
+	append_u32(file, frame_count);
+	append_u32(file, static_cast<uint32_t>(SRLV::video_header_size));
+	file.insert(file.end(), index_entries * SRLV::frame_index_entry_size, 0);
+	return file;
+}
+
+// Returns whether SRLVFile rejects headers whose frame count doesn't fit the file, before allocating memory for the frames.
+bool verify_srlv_file()
+{
+	Checks check("srlv file");
+
+	SdFs card;
+	auto const add_video = [&](std::string const& name, std::vector<uint8_t> const& data) {
+		card.add_file(name, data, { { static_cast<uint32_t>(card.the_card.image.size() / STUB_SECTOR_SIZE), static_cast<uint32_t>((data.size() + STUB_SECTOR_SIZE - 1) / STUB_SECTOR_SIZE) } });
+	};
+	add_video("valid", make_video(10, 10));
+	add_video("truncated index", make_video(11, 10));
+	add_video("huge frame count", make_video(0xFFFFFFFF, 10));
+	add_video("too long", make_video(MAX_FRAME_COUNT + 1, MAX_FRAME_COUNT + 1));
+
+	SRLVFile video(card);
+	check(video.open("valid") && video.frame_count() == 10, "valid video");
+	check(!video.open("truncated index") && !video.is_open(), "index past the end of the file");
+	check(!video.open("huge frame count") && !video.is_open(), "huge frame count");
+	check(!video.open("too long"), "frame count above the maximum");
+	return check.report();
+}
+
+int main()
+{
+	// run all tests, so that one failure doesn't hide others
+	auto ok = verify_pcm_ring();
+	ok = verify_gain_stage() && ok;
+	ok = verify_sd_source() && ok;
+	ok = verify_srlv_audio_source() && ok;
+	ok = verify_srlv_file() && ok;
+	return ok ? 0 : 1;
+}
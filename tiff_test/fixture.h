@@ -0,0 +1,33 @@
+// Generated by make_fixture.py.
+static unsigned char frame_0[] PROGMEM = { 0x00, 0xcf, 0x81, 0xae, 0x81, 0x9f, 0x81, 0xcd, 0x82, 0xcd, 0x81, 0xce, 0x81, 0xce, 0x81, 0xa6, 0x81, 0xa6, 0x82, 0xcd, 0x81, 0xce, 0x81, 0xce, 0x81, 0xcd, 0x82, 0xcd, 0x81, 0xce, 0x81, 0xce, 0x81, 0x9c, 0x85, 0xac, 0x82, 0x9c, 0x87, 0xa5, 0x14, 0x81, 0x9d, 0x89, 0xa8, 0x81, 0x9d, 0x8b, 0xa6, 0x81, 0x9d, 0x8d, 0xa3, 0x82, 0x9e, 0x8d, 0xa2, 0x81, 0xa0, 0x8d, 0xa1, 0x81, 0xa1, 0x8d, 0xa0, 0x81, 0xa2, 0x8d, 0x9e, 0x82, 0xa4, 0x8b, 0x9e, 0x81, 0xa7, 0x89, 0x9e, 0x81, 0xa9, 0x87, 0x9e, 0x81, 0xab, 0x85, 0x9d, 0x82, 0xb3, 0x81, 0x99, 0x81, 0xce, 0x81, 0xce, 0x81, 0xcd, 0x82, 0xcd, 0x16, 0x81, 0xc7, 0x81, 0xcd, 0x82, 0xcd, 0x81, 0xce, 0x81, 0xce, 0x81, 0xcd, 0x82, 0xcd, 0x81, 0xce, 0x81, 0xce, 0x81, 0xcd, 0x82, 0xcd, 0x81, 0xce, 0x81, 0xce, 0x81, 0xcd, 0x24, 0x81, 0xc8, 0x81, 0xb0, 0x81, 0x9d, 0x81, 0xce, 0x81, 0xa9, 0x81, 0xa3, 0x82, 0xbd, 0x1f, 0x81, 0xbf, 0x1e, 0x81, 0xc0, 0x1d, 0x81, 0xc1, 0x13, 0x17, 0x82, 0xc2, 0x1a, 0x19, 0x81, 0xc4, 0x81, 0xce, 0x81, 0xcd, 0x82, 0xcd, 0x81, 0x92, 0x81, 0xbb, 0x81, 0xce, 0x81, 0xcd, 0x82, 0x9e, 0x81, 0xae, 0x81, 0xce, 0x81, 0xcf };
+static unsigned char frame_1[] PROGMEM = { 0x01, 0xfe, 0x81, 0xed, 0x81, 0xce, 0x82, 0x9d, 0x81, 0xb0, 0x81, 0xf4, 0x81, 0xa6, 0x81, 0xce, 0x82, 0xcd, 0x82, 0xcd, 0x82, 0xcc, 0x83, 0xcc, 0x83, 0xcc, 0x82, 0xcd, 0x82, 0x9b, 0x41, 0x47, 0x81, 0xa0, 0x83, 0x9b, 0x34, 0x85, 0xa0, 0x14, 0x11, 0x81, 0x96, 0x14, 0x36, 0x85, 0xa3, 0x11, 0x1b, 0x1f, 0x38, 0x85, 0xa1, 0x11, 0x81, 0x9b, 0x49, 0x84, 0x9f, 0x84, 0x9c, 0x3a, 0x85, 0x9d, 0x11, 0x81, 0x9e, 0x3a, 0x85, 0x9c, 0x11, 0x81, 0x9f, 0x3a, 0x85, 0x9b, 0x11, 0x81, 0xa0, 0x3a, 0x85, 0x99, 0x21, 0x81, 0xa2, 0x29, 0x66, 0x81, 0x91, 0x12, 0x81, 0xa4, 0x27, 0x86, 0x98, 0x12, 0x81, 0xa6, 0x16, 0x87, 0x97, 0x11, 0x82, 0xa8, 0x14, 0x87, 0x96, 0x21, 0x81, 0x96, 0x81, 0x95, 0x51, 0x83, 0x96, 0x12, 0x81, 0xaf, 0x85, 0x97, 0x12, 0x81, 0xcb, 0x12, 0x81, 0xca, 0x22, 0x81, 0xca, 0x13, 0x12, 0x81, 0xc7, 0x12, 0x82, 0xa2, 0x81, 0xa6, 0x22, 0x81, 0xca, 0x13, 0x81, 0xca, 0x13, 0x81, 0xca, 0x13, 0x18, 0x81, 0xc0, 0x23, 0x81, 0xc9, 0x14, 0x81, 0xc9, 0x13, 0x82, 0xc9, 0x13, 0x81, 0xc9, 0x23, 0x81, 0xa2, 0x81, 0x92, 0x81, 0x93, 0x14, 0x81, 0xc9, 0x14, 0x81, 0xc9, 0x14, 0x81, 0xc8, 0x82, 0xcd, 0x14, 0x82, 0xaa, 0x81, 0x9d, 0x14, 0x81, 0xc9, 0x14, 0x81, 0xa4, 0x81, 0x92, 0x6b, 0x24, 0x81, 0xa3, 0x81, 0x95, 0x5a, 0x15, 0x81, 0xba, 0x59, 0x15, 0x81, 0xbb, 0x58, 0x15, 0x81, 0xbc, 0x31, 0x16, 0x24, 0x82, 0xbd, 0x55, 0x15, 0x13, 0x81, 0xc4, 0x15, 0x81, 0xc8, 0x15, 0x81, 0xc7, 0x25, 0x81, 0xc7, 0x16, 0x1b, 0x81, 0xbb, 0x16, 0x81, 0xc7, 0x15, 0x82, 0xc6, 0x25, 0x81, 0x98, 0x81, 0xae, 0x16, 0x81, 0xc7, 0x16, 0x81, 0xc8 };
+static unsigned char frame_2[] PROGMEM = { 0x02, 0x0a, 0x81, 0xc4, 0x11, 0x81, 0xff, 0x80, 0x9c, 0x15, 0x81, 0xe3, 0x81, 0xb3, 0x19, 0x81, 0xa0, 0x81, 0xf2, 0x1d, 0x81, 0xff, 0x80, 0x90, 0x81, 0x91, 0x81, 0xff, 0x0c, 0x81, 0x95, 0x17, 0x81, 0xff, 0x81, 0x99, 0x81, 0xd6, 0x85, 0xa8, 0x81, 0x9d, 0x81, 0xa5, 0x89, 0xa3, 0x8b, 0xa2, 0x82, 0xa2, 0x81, 0xa0, 0x8e, 0x9e, 0x8f, 0x9e, 0x81, 0xa7, 0x81, 0x9d, 0x8f, 0x9d, 0x91, 0x9b, 0x81, 0xab, 0x81, 0x9a, 0x91, 0x9c, 0x91, 0x99, 0x81, 0xaf, 0x81, 0x98, 0x91, 0x9c, 0x91, 0x97, 0x81, 0xb3, 0x81, 0x97, 0x8f, 0x9e, 0x8f, 0x96, 0x81, 0xb7, 0x81, 0x96, 0x8d, 0xa1, 0x8b, 0x96, 0x81, 0xbb, 0x81, 0x96, 0x89, 0xa6, 0x85, 0x97, 0x81, 0xbf, 0x81, 0xdd, 0x81, 0xa8, 0x81, 0x9a, 0x81, 0xd9, 0x81, 0xc7, 0x81, 0xd5, 0x81, 0xcb, 0x81, 0xd1, 0x81, 0xb1, 0x81, 0x9d, 0x81, 0xcd, 0x81, 0xd3, 0x81, 0xc9, 0x81, 0xd7, 0x81, 0xc5, 0x81, 0x9b, 0x81, 0xbf, 0x81, 0xc1, 0x81, 0xd8, 0x16, 0x82, 0x9e, 0x8b, 0x92, 0x81, 0xe5, 0x81, 0x91, 0x96, 0x90, 0x81, 0xe9, 0x1f, 0x96, 0x8e, 0x81, 0xa1, 0x81, 0xcb, 0x1d, 0x96, 0x8c, 0x81, 0xf1, 0x81, 0xab, 0x81, 0xf5, 0x81, 0xa7, 0x81, 0xf9, 0x81, 0xa3, 0x81, 0x9f, 0x81, 0xdd, 0x81, 0x9f, 0x81, 0x90, 0x81, 0xf0, 0x1e };
+static unsigned char frame_3[] PROGMEM = { 0x03, 0xc8, 0x03, 0x91, 0x0f, 0xa2, 0x03, 0xc1, 0x03, 0xb0, 0x03, 0x83, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc2, 0x03, 0xac, 0x03, 0x87, 0x03, 0xb9, 0x03, 0x06, 0xc2, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0x90, 0x03, 0xa3, 0x03, 0x97, 0x21, 0x9c, 0x03, 0x96, 0x01, 0x04, 0x96, 0x03, 0x95, 0x01, 0x40, 0x97, 0x03, 0x95, 0x01, 0x81, 0x01, 0x8f, 0x03, 0x88, 0x03, 0x80, 0x01, 0x81, 0x01, 0x8e, 0x03, 0x96, 0x01, 0x83, 0x01, 0x8d, 0x03, 0x96, 0x01, 0x83, 0x01, 0x8c, 0x03, 0x96, 0x01, 0x85, 0x01, 0x8a, 0x03, 0x97, 0x01, 0x85, 0x01, 0x89, 0x03, 0x98, 0x01, 0x85, 0x01, 0x88, 0x03, 0x99, 0x01, 0x85, 0x01, 0x87, 0x03, 0x9a, 0x01, 0x85, 0x01, 0x86, 0x03, 0x9c, 0x01, 0x83, 0x01, 0x86, 0x03, 0x9d, 0x01, 0x83, 0x01, 0x85, 0x03, 0x9f, 0x01, 0x81, 0x01, 0x85, 0x03, 0xa0, 0x01, 0x81, 0x01, 0x84, 0x03, 0xa2, 0x01, 0x40, 0x40, 0x01, 0x18, 0xa8, 0x01, 0x04, 0x87, 0x03, 0xa8, 0x21, 0x8c, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xa0, 0x03, 0x93, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc2, 0x03, 0xc1, 0x03, 0x9d, 0x01, 0x82, 0x01, 0x86, 0x03, 0x9e, 0x01, 0x82, 0x01, 0x85, 0x03, 0x9f, 0x01, 0x82, 0x01, 0x84, 0x03, 0xa0, 0x01, 0x82, 0x01, 0x83, 0x03, 0x9a, 0x03, 0x01, 0x82, 0x01, 0x82, 0x03, 0xa2, 0x01, 0x82, 0x01, 0x81, 0x03, 0xa3, 0x01, 0x82, 0x01, 0x80, 0x03, 0xa4, 0x01, 0x82, 0x01, 0x40, 0x01, 0xc0, 0x03, 0xc1, 0x03, 0xc2, 0x0f, 0xc1, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc1, 0x03 };
+static unsigned char frame_4[] PROGMEM = { 0x04, 0x18, 0xe0, 0x0f, 0xb6, 0x03, 0xeb, 0x03, 0x83, 0x05, 0xc1, 0x05, 0xc1, 0x05, 0xc1, 0x05, 0xfc, 0x03, 0x87, 0x05, 0xb9, 0x03, 0x0a, 0xc2, 0x05, 0x8d, 0x03, 0xa6, 0x05, 0xc1, 0x05, 0x90, 0x03, 0xa3, 0x05, 0x03, 0x90, 0x29, 0x08, 0x95, 0x0f, 0x96, 0x09, 0x04, 0x01, 0x8f, 0x0f, 0x95, 0x11, 0x40, 0x08, 0x90, 0x0f, 0x95, 0x11, 0x81, 0x11, 0x8f, 0x0f, 0x88, 0x03, 0x80, 0x09, 0x81, 0x21, 0x8e, 0x0f, 0x96, 0x09, 0x83, 0x21, 0x8d, 0x0f, 0x96, 0x09, 0x83, 0x21, 0x8c, 0x0f, 0x96, 0x09, 0x85, 0x21, 0x8a, 0x0f, 0x97, 0x09, 0x85, 0x21, 0x89, 0x0f, 0x98, 0x09, 0x85, 0x21, 0x88, 0x0f, 0x99, 0x09, 0x85, 0x21, 0x87, 0x1b, 0x9a, 0x09, 0x85, 0x21, 0x86, 0x1b, 0x90, 0x03, 0x20, 0x01, 0x81, 0x41, 0x86, 0x1b, 0x9d, 0x05, 0x83, 0x41, 0x85, 0x1b, 0x9f, 0x05, 0x81, 0x41, 0x85, 0x1b, 0xa0, 0x05, 0x81, 0x41, 0x84, 0x33, 0xa2, 0x05, 0x40, 0x60, 0x01, 0x18, 0x03, 0xa1, 0x03, 0x04, 0x04, 0x80, 0x33, 0xad, 0x01, 0x02, 0x80, 0x1b, 0xa9, 0x01, 0x10, 0x83, 0x1b, 0xac, 0x01, 0x01, 0x80, 0x1b, 0xc1, 0x33, 0xbb, 0x43, 0x19, 0x9f, 0x03, 0x93, 0x33, 0xc1, 0x33, 0xc1, 0x33, 0xc1, 0x63, 0xc1, 0x63, 0xc1, 0x63, 0xc1, 0x63, 0xc1, 0x63, 0xc2, 0x63, 0x9c, 0x01, 0x87, 0x01, 0x82, 0x63, 0xad, 0x21, 0x86, 0x63, 0xae, 0x21, 0x85, 0x63, 0xaf, 0x21, 0x84, 0x63, 0x80, 0x03, 0xa2, 0x21, 0x83, 0x43, 0x01, 0x93, 0x03, 0x89, 0x21, 0x82, 0x43, 0x01, 0xab, 0x21, 0x81, 0x43, 0x07, 0xac, 0x21, 0x80, 0x43, 0x01, 0xad, 0x21, 0x40, 0x61, 0xc0, 0x43, 0x01, 0xba, 0x03, 0x03, 0xbb, 0x4f, 0x01, 0xba, 0x43, 0x01, 0xba, 0x4f, 0x01, 0xba, 0x43, 0x01, 0xba, 0x03, 0x03, 0xba, 0x03, 0x03, 0xba, 0x03, 0x03 };
+static unsigned char frame_5[] PROGMEM = { 0x05, 0x01, 0x8f, 0x03, 0xa4, 0x0f, 0xaf, 0x03, 0xd4, 0x33, 0xbf, 0x03, 0xc3, 0x03, 0x03, 0x03, 0xff, 0x30, 0x80, 0x03, 0xff, 0x60, 0x03, 0x40, 0x01, 0xff, 0x30, 0x86, 0x03, 0xff, 0x0c, 0x86, 0x03, 0xb9, 0x03, 0x8d, 0x21, 0x9c, 0x03, 0x87, 0x03, 0x97, 0x01, 0x01, 0xa5, 0x01, 0x04, 0x96, 0x03, 0x8a, 0x03, 0x93, 0x01, 0x10, 0xa5, 0x01, 0x40, 0x96, 0x03, 0x8d, 0x03, 0x91, 0x01, 0x40, 0xa6, 0x01, 0x40, 0x95, 0x03, 0x90, 0x03, 0x8f, 0x01, 0x40, 0xa6, 0x01, 0x40, 0x94, 0x03, 0x92, 0x03, 0x8f, 0x01, 0x10, 0xa7, 0x01, 0x04, 0x90, 0x05, 0x95, 0x03, 0x90, 0x01, 0x01, 0xa7, 0x21, 0x94, 0x03, 0x98, 0x03, 0xea, 0x03, 0x9b, 0x03, 0xa4, 0x03, 0xb6, 0x03, 0x9e, 0x03, 0x30, 0xde, 0x03, 0x9c, 0x33, 0xe6, 0x03, 0xa3, 0x03, 0xe0, 0x03, 0xa6, 0x03, 0xdc, 0x03, 0xa9, 0x03, 0xda, 0x03, 0xac, 0x03, 0xd7, 0x03, 0xae, 0x03, 0xce, 0x43, 0x01, 0xb0, 0x03, 0x89, 0x01, 0xa6, 0x01, 0x87, 0x03, 0xb4, 0x03, 0x87, 0x01, 0xa6, 0x01, 0x85, 0x03, 0xb7, 0x03, 0x86, 0x01, 0xa6, 0x01, 0x84, 0x03, 0xba, 0x03, 0x84, 0x01, 0xa6, 0x01, 0x83, 0x03, 0xbc, 0x03, 0x83, 0x01, 0xa6, 0x01, 0x81, 0x03, 0xbf, 0x03, 0xc4, 0x03, 0xc2, 0x03, 0xc0, 0x03, 0xc5, 0x33, 0xbe, 0x03, 0xc8, 0x03, 0xbb, 0x03, 0xca, 0x03 };
+static unsigned char frame_6[] PROGMEM = { 0x06, 0x00, 0xff, 0xff, 0x20, 0x46, 0x21, 0x6e, 0x22, 0x6f, 0xff, 0x1f, 0x0e, 0x1d, 0x16, 0x89, 0xd1, 0x68, 0x9d, 0x16, 0x89, 0xd1, 0x68, 0x00, 0x2c, 0x10, 0x13, 0xd2, 0x7a, 0x02, 0x7f, 0x00, 0x80, 0x2a, 0x3f, 0x8a, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x8a, 0x38, 0xa3, 0x86, 0x38, 0xa3, 0x86, 0x38, 0xa3, 0x86, 0x38, 0xa3, 0x8a, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x8a, 0x38, 0xa3, 0x86, 0x38, 0xa3, 0x86, 0x38, 0xa3, 0x8a, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x8a, 0x38, 0xa3, 0x86, 0x38, 0xa3, 0x86, 0x38, 0xa3, 0x8a, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x8a, 0x38, 0xa3, 0x86, 0x38, 0xa3, 0x86, 0x38, 0xa3, 0x8a, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x8a, 0x38, 0xa3, 0x86, 0x38, 0xa3, 0x86, 0x39, 0x21, 0x8e, 0x38, 0x63, 0x8a, 0x38, 0xa3, 0x86, 0x38, 0xa3, 0x86, 0x38, 0xa3, 0x35, 0x9a, 0x36, 0x99, 0xcd, 0x9d, 0x38, 0xcb, 0xab, 0x13, 0x22, 0xab, 0x24, 0xa2, 0x4d, 0xab };
+static unsigned char frame_7[] PROGMEM = { 0x00, 0xcf, 0x81, 0xcf, 0x81, 0xce, 0x81, 0xcf, 0x81, 0xce, 0x81, 0xcf, 0x81, 0xce, 0x81, 0xcf, 0x81, 0xce, 0x81, 0xcf, 0x81, 0xce, 0x81, 0xcf, 0x81, 0xce, 0x81, 0xcf, 0x81, 0xa9, 0x85, 0xa0, 0x81, 0xa8, 0x89, 0x9e, 0x81, 0xa7, 0x8b, 0x9c, 0x81, 0xa7, 0x8d, 0x9b, 0x81, 0xa6, 0x8f, 0x99, 0x81, 0xa7, 0x8f, 0x99, 0x81, 0xa6, 0x91, 0x97, 0x81, 0xa7, 0x91, 0x97, 0x81, 0xa7, 0x91, 0x95, 0x11, 0x81, 0xa7, 0x91, 0x96, 0x81, 0xa8, 0x91, 0x96, 0x81, 0xa9, 0x8f, 0x96, 0x1c, 0x81, 0x9d, 0x8f, 0x51, 0x90, 0x81, 0xab, 0x8d, 0x96, 0x11, 0x81, 0xab, 0x8b, 0x97, 0x81, 0xae, 0x89, 0x97, 0x81, 0xb1, 0x85, 0x99, 0x81, 0xce, 0x81, 0xcf, 0x81, 0xce, 0x81, 0xcf, 0x81, 0xce, 0x81, 0xcf, 0x81, 0x9f, 0x81, 0xae, 0x81, 0xcf, 0x81, 0xce, 0x81, 0xcf, 0x81, 0xa0, 0x81, 0xad, 0x81, 0xcf, 0x81, 0xcf, 0x81, 0xce, 0x81, 0xcf, 0x81, 0xb4, 0x81, 0x99, 0x81, 0xcf, 0x81, 0xce, 0x81, 0xcf, 0x81, 0x97, 0xa4, 0x93, 0x81, 0x98, 0xa4, 0x93, 0x81, 0x98, 0xa4, 0x92, 0x81, 0x99, 0xa4, 0x92, 0x81, 0x99, 0xa4, 0x91, 0x81, 0xcf, 0x81, 0xa1, 0x81, 0xac, 0x81, 0x91, 0x81, 0x92, 0x81, 0xaa, 0x81, 0xc7, 0x16, 0x81, 0xcf, 0x81, 0xce, 0x81, 0xcf, 0x81, 0xce, 0x81, 0xcf, 0x81, 0x9e };
+static unsigned char frame_8[] PROGMEM = { 0x01, 0x80, 0xff, 0x80, 0xff, 0x80, 0xff, 0x80, 0x90, 0x82, 0xff, 0x80, 0x99, 0x14, 0x82, 0xff, 0x80, 0x9e, 0x82, 0xce, 0x82, 0xa4, 0x81, 0xa8, 0x82, 0xce, 0x29, 0x81, 0xc3, 0x11, 0x81, 0xcd, 0x82, 0xa8, 0x41, 0x84, 0x9c, 0x11, 0x81, 0xa6, 0x45, 0x84, 0x9a, 0x11, 0x81, 0x9f, 0x15, 0x38, 0x85, 0x97, 0x11, 0x81, 0xa5, 0x3a, 0x85, 0x96, 0x11, 0x81, 0xa4, 0x4b, 0x84, 0x95, 0x11, 0x81, 0xa5, 0x3c, 0x85, 0x94, 0x11, 0x13, 0x81, 0xa0, 0x4d, 0x84, 0x93, 0x12, 0x81, 0xa4, 0x3e, 0x85, 0x92, 0x11, 0x81, 0xa5, 0x3e, 0x85, 0x90, 0x11, 0x11, 0x81, 0xa5, 0x3e, 0x85, 0x91, 0x12, 0x81, 0xa5, 0x3e, 0x85, 0x91, 0x11, 0x81, 0xa7, 0x2d, 0x86, 0x90, 0x12, 0x19, 0x81, 0x9d, 0x3c, 0x86, 0x90, 0x12, 0x81, 0xa8, 0x2b, 0x86, 0x90, 0x11, 0x82, 0x9e, 0x1b, 0x29, 0x86, 0x91, 0x12, 0x81, 0xab, 0x18, 0x87, 0x90, 0x12, 0x81, 0xb3, 0x88, 0x91, 0x12, 0x81, 0xb0, 0x89, 0x92, 0x13, 0x81, 0xb2, 0x85, 0x94, 0x12, 0x81, 0xcb, 0x13, 0x81, 0xcb, 0x13, 0x81, 0xca, 0x13, 0x81, 0xcb, 0x13, 0x81, 0x9b, 0x81, 0xae, 0x13, 0x81, 0xcb, 0x13, 0x1d, 0x81, 0xbc, 0x14, 0x81, 0xca, 0x13, 0x81, 0x9c, 0x18, 0x81, 0xa4, 0x14, 0x81, 0xca, 0x14, 0x81, 0xca, 0x13, 0x81, 0xca, 0x14, 0x1e, 0x81, 0xbb, 0x14, 0x81, 0xad, 0x11, 0x81, 0x99, 0x14, 0x81, 0xca, 0x14, 0x81, 0xc9, 0x14, 0x81, 0x92, 0xa9, 0x8f, 0x14, 0x81, 0xb6, 0x5e, 0x15, 0x81, 0xb6, 0x5e, 0x14, 0x81, 0xb7, 0x5d, 0x15, 0x81, 0xb7, 0x5d, 0x15, 0x81, 0xb7, 0x5c, 0x15, 0x81, 0xc9, 0x15, 0x81, 0x9b, 0x81, 0xac, 0x16, 0x1a, 0x81, 0x92, 0x81, 0xaa, 0x15, 0x81, 0xc1, 0x16, 0x16, 0x81, 0xc8, 0x15, 0x81, 0xc8, 0x16, 0x81, 0xc8, 0x16, 0x81, 0xc7, 0x16, 0x81, 0xc8, 0x16, 0x81, 0x97 };
+static unsigned char frame_9[] PROGMEM = { 0x02, 0xcf, 0x82, 0xdf, 0x81, 0xbd, 0x12, 0x81, 0xff, 0x80, 0x9d, 0x12, 0x81, 0xff, 0x80, 0x9c, 0x14, 0x81, 0xfb, 0x81, 0x9e, 0x14, 0x81, 0xff, 0x80, 0x9a, 0x16, 0x81, 0xff, 0x80, 0x99, 0x16, 0x81, 0x97, 0x81, 0xde, 0x87, 0x9a, 0x18, 0x81, 0x98, 0x8b, 0xcf, 0x8d, 0x97, 0x18, 0x81, 0x96, 0x8f, 0xcb, 0x91, 0x94, 0x1a, 0x81, 0x93, 0x93, 0xc6, 0x11, 0x93, 0x93, 0x1a, 0x81, 0x92, 0x95, 0xc6, 0x95, 0x91, 0x1c, 0x81, 0x91, 0x95, 0xc6, 0x95, 0x91, 0x1c, 0x81, 0x91, 0x95, 0xc6, 0x95, 0x90, 0x1e, 0x81, 0x90, 0x95, 0xc7, 0x93, 0x91, 0x1e, 0x81, 0x91, 0x93, 0xc9, 0x91, 0x91, 0x81, 0x90, 0x81, 0x92, 0x8f, 0xcd, 0x8d, 0x93, 0x81, 0x90, 0x81, 0x94, 0x8b, 0xd2, 0x87, 0x95, 0x81, 0x92, 0x81, 0xff, 0x0d, 0x81, 0x92, 0x81, 0xff, 0x0c, 0x1e, 0x15, 0x81, 0xff, 0x0b, 0x81, 0x94, 0x81, 0xd2, 0x81, 0xb6, 0x81, 0x96, 0x81, 0xff, 0x09, 0x81, 0x96, 0x81, 0xfc, 0x1a, 0x81, 0x98, 0x11, 0x81, 0xc1, 0xae, 0x95, 0x81, 0x98, 0x81, 0x95, 0xdc, 0x94, 0x81, 0x9a, 0x81, 0x94, 0xdc, 0x94, 0x81, 0x9a, 0x81, 0x94, 0xdc, 0x93, 0x81, 0x9c, 0x81, 0x99, 0x81, 0xe8, 0x81, 0x9c, 0x81, 0xff, 0x02, 0x81, 0x9e, 0x81, 0xd6, 0x81, 0xa9, 0x81, 0x9e, 0x81, 0xff, 0x81, 0xa0, 0x81, 0xbf };
+static unsigned char frame_10[] PROGMEM = { 0x03, 0xb6, 0x03, 0x84, 0x03, 0xc2, 0x03, 0xc2, 0x03, 0xc2, 0x03, 0xb1, 0x63, 0x82, 0x03, 0xc2, 0x03, 0xc2, 0x03, 0xc2, 0x03, 0xc2, 0x03, 0xa4, 0x03, 0x90, 0x03, 0xc2, 0x03, 0xaa, 0x03, 0x89, 0x03, 0xc2, 0x03, 0xc2, 0x03, 0x9f, 0x21, 0x95, 0x03, 0x9e, 0x01, 0x01, 0x8f, 0x03, 0x9d, 0x01, 0x04, 0x90, 0x03, 0x9c, 0x01, 0x10, 0x91, 0x03, 0x9b, 0x01, 0x40, 0x91, 0x03, 0x9c, 0x01, 0x40, 0x91, 0x03, 0x9c, 0x01, 0x40, 0x91, 0x03, 0x9c, 0x01, 0x40, 0x91, 0x03, 0x9c, 0x01, 0x40, 0x91, 0x03, 0x9d, 0x01, 0x10, 0x90, 0x03, 0x9e, 0x01, 0x04, 0x8f, 0x03, 0x9f, 0x01, 0x01, 0x8d, 0x03, 0xa1, 0x21, 0x93, 0x03, 0xc2, 0x03, 0xb8, 0x03, 0x18, 0xc5, 0x03, 0xab, 0x03, 0x89, 0x03, 0xc2, 0x03, 0xc1, 0x03, 0xc2, 0x03, 0xb7, 0x03, 0x30, 0xc5, 0x05, 0xc3, 0x03, 0xc2, 0x03, 0xc2, 0x03, 0xc1, 0x03, 0xc2, 0x03, 0xc2, 0x03, 0xc2, 0x03, 0xc2, 0x03, 0xa0, 0x03, 0x94, 0x03, 0xc2, 0x03, 0xc1, 0x03, 0x02, 0xa6, 0x01, 0x87, 0x03, 0x02, 0xa6, 0x01, 0x87, 0x03, 0x02, 0xa6, 0x01, 0x87, 0x03, 0x02, 0xa6, 0x01, 0x87, 0x03, 0x02, 0xa6, 0x01, 0x81, 0x43, 0x01, 0x01, 0xa5, 0x01, 0x87, 0x03, 0x02, 0xa6, 0x01, 0x86, 0x03, 0x04, 0xa7, 0x01, 0x86, 0x03, 0xc2, 0x03, 0xc2, 0x03, 0xc2, 0x03, 0xc2, 0x03, 0xc2, 0x03, 0xa3, 0x03, 0x90, 0x03, 0xc2, 0x03, 0xc2, 0x03, 0xc2, 0x03 };
+static unsigned char frame_11[] PROGMEM = { 0x04, 0x01, 0xaf, 0x03, 0xff, 0xff, 0xa7, 0x63, 0x82, 0x05, 0xa6, 0x03, 0x81, 0x03, 0x40, 0x02, 0xc1, 0x05, 0xc2, 0x05, 0xc2, 0x05, 0xa4, 0x03, 0x90, 0x05, 0xc2, 0x05, 0xaa, 0x03, 0x89, 0x0f, 0xc2, 0x0f, 0xc2, 0x0f, 0x9f, 0x31, 0x04, 0x8e, 0x0f, 0x9e, 0x09, 0x21, 0x8f, 0x0f, 0x9d, 0x09, 0x04, 0x01, 0x89, 0x05, 0x9c, 0x09, 0x10, 0x04, 0x8a, 0x05, 0x9b, 0x11, 0x40, 0x08, 0x8a, 0x0f, 0x9c, 0x09, 0x40, 0x10, 0x8a, 0x0f, 0x9c, 0x09, 0x40, 0x10, 0x8a, 0x0f, 0x9c, 0x09, 0x40, 0x10, 0x8a, 0x0f, 0x9c, 0x09, 0x40, 0x10, 0x8a, 0x0f, 0x9d, 0x05, 0x10, 0x08, 0x89, 0x0f, 0x9e, 0x05, 0x04, 0x02, 0x88, 0x0f, 0x9f, 0x03, 0x01, 0x01, 0x86, 0x1b, 0x8d, 0x03, 0x86, 0x23, 0x20, 0x8c, 0x1b, 0xa3, 0x01, 0x04, 0x8a, 0x1b, 0xa5, 0x21, 0x85, 0x03, 0x58, 0x01, 0xbe, 0x1b, 0xab, 0x03, 0x89, 0x1b, 0xc2, 0x1b, 0xc1, 0x33, 0xc2, 0x33, 0xb7, 0x03, 0x30, 0x06, 0xbc, 0x17, 0x03, 0x9e, 0x03, 0x92, 0x33, 0xc2, 0x33, 0xc2, 0x33, 0xa3, 0x03, 0x90, 0x63, 0xc2, 0x63, 0xc2, 0x63, 0xc2, 0x63, 0xc2, 0x63, 0xa0, 0x03, 0x94, 0x63, 0xc2, 0x63, 0x01, 0xaa, 0x01, 0x82, 0x43, 0x01, 0xa6, 0x21, 0x87, 0x43, 0x01, 0xa6, 0x21, 0x87, 0x63, 0xad, 0x21, 0x87, 0x63, 0xad, 0x21, 0x87, 0x63, 0xad, 0x21, 0x81, 0x43, 0x31, 0xac, 0x21, 0x87, 0x63, 0xad, 0x21, 0x86, 0x43, 0x01, 0xa7, 0x21, 0x86, 0x43, 0x01, 0x99, 0x03, 0x94, 0x43, 0x01, 0xbb, 0x43, 0x01, 0xb1, 0x03, 0x18, 0x0c, 0xbe, 0x43, 0x01, 0xbb, 0x43, 0x01, 0x9c, 0x03, 0x90, 0x03, 0x03, 0xbb, 0x03, 0x03, 0xbb, 0x03, 0x03, 0xbb, 0x03, 0x03 };
+static unsigned char frame_12[] PROGMEM = { 0x05, 0xc8, 0x0f, 0xff, 0x8a, 0x43, 0x02, 0x9d, 0x03, 0xdd, 0x03, 0x60, 0xff, 0x83, 0x03, 0x82, 0x03, 0xff, 0x05, 0x88, 0x03, 0xfa, 0x03, 0x8c, 0x03, 0xb7, 0x03, 0xb1, 0x03, 0x90, 0x05, 0xe5, 0x21, 0x60, 0x9b, 0x23, 0x80, 0x01, 0xd1, 0x01, 0x50, 0x01, 0x99, 0x01, 0x80, 0x01, 0xcd, 0x01, 0x81, 0x01, 0x9a, 0x01, 0x81, 0x01, 0xcb, 0x01, 0x83, 0x01, 0x98, 0x01, 0x83, 0x01, 0xca, 0x01, 0x83, 0x01, 0x98, 0x01, 0x83, 0x01, 0xca, 0x01, 0x83, 0x01, 0x99, 0x01, 0x81, 0x01, 0xcc, 0x01, 0x81, 0x01, 0x9b, 0x01, 0x40, 0xd4, 0x01, 0x20, 0xa4, 0x01, 0x54, 0xcf, 0x03, 0x21, 0xb5, 0x03, 0xc6, 0x03, 0xc0, 0x03, 0xc1, 0x05, 0xc6, 0x03, 0xbc, 0x03, 0xca, 0x03, 0xb8, 0x03, 0x03, 0xc7, 0x45, 0x01, 0xac, 0x03, 0xa8, 0x03, 0x9e, 0x03, 0xae, 0x03, 0xd8, 0x03, 0xaa, 0x03, 0xa5, 0x03, 0x87, 0x01, 0xec, 0x01, 0x98, 0x01, 0xec, 0x31, 0x98, 0x01, 0xec, 0x01, 0x95, 0x0b, 0xef, 0x01, 0x98, 0x01, 0xec, 0x01, 0xc6, 0x05, 0x8d, 0x03, 0xfa, 0x03, 0x88, 0x03, 0xfe, 0x03, 0x83, 0x05, 0xff, 0x60, 0x83, 0x03, 0xf7, 0x03, 0x83, 0x03 };
+static unsigned char frame_13[] PROGMEM = { 0x06, 0x00, 0xff, 0x9c, 0x00, 0x9d, 0x46, 0xff, 0x22, 0x9e, 0x9f, 0x36, 0x0e, 0x6d, 0x25, 0x25, 0xb4, 0x94, 0x96, 0xd2, 0x4f, 0xf2, 0x5b, 0x49, 0x48, 0x21, 0x2b, 0xeb, 0x00, 0xbe, 0xc4, 0xf6, 0x00, 0x33, 0xc7, 0x98, 0x6f, 0x62, 0x7b, 0x00, 0xc0, 0x80, 0x0b, 0x3f, 0x8a, 0x38, 0xa3, 0x8a, 0x38, 0xa3, 0x8a, 0x38, 0xa3, 0x8a, 0x18, 0xa3, 0x91, 0x9e, 0x34, 0xfd, 0x1d, 0x88, 0x22, 0x8e, 0x28, 0xe2, 0x8e, 0x28, 0xe2, 0x8e, 0x28, 0xe2, 0x8e, 0x28, 0xe2, 0x8e, 0x28, 0xe2, 0x86, 0x28, 0xe2, 0x8e, 0x6b, 0x16, 0x49, 0x9a, 0xf8, 0xa3, 0x8a, 0x38, 0xa3, 0x8a, 0x38, 0xa3, 0x8a, 0x38, 0xa3, 0x8a, 0x38, 0xa3, 0x8a, 0x18, 0xa3, 0x8a, 0x38, 0xa3, 0x8a, 0x38, 0xa3, 0x8a, 0x38, 0x6c, 0x31, 0xb4, 0x9f, 0x20 };
+static unsigned char frame_14[] PROGMEM = { 0x00, 0x80, 0xa1, 0x81, 0xa4, 0x18, 0x81, 0xce, 0x81, 0xce, 0x81, 0xce, 0x81, 0xce, 0x81, 0xce, 0x81, 0xce, 0x11, 0x81, 0xcc, 0x81, 0xac, 0x81, 0xa1, 0x81, 0xce, 0x81, 0xce, 0x81, 0xce, 0x81, 0xce, 0x81, 0xce, 0x81, 0xc6, 0x71, 0x81, 0xc5, 0x8b, 0xc4, 0x8d, 0xc2, 0x8f, 0xc0, 0x91, 0xbe, 0x93, 0xbd, 0x93, 0x21, 0xb9, 0x95, 0xbb, 0x95, 0xbb, 0x95, 0xbb, 0x95, 0xbb, 0x95, 0xbb, 0x95, 0xb5, 0x15, 0x95, 0xbc, 0x93, 0xbd, 0x93, 0xbc, 0x11, 0x91, 0xbc, 0x13, 0x8f, 0xbc, 0x15, 0x8d, 0xbc, 0x17, 0x8b, 0xbc, 0x1a, 0x87, 0xbd, 0x81, 0xce, 0x81, 0xce, 0x81, 0xce, 0x81, 0xce, 0x81, 0xce, 0x81, 0xce, 0x81, 0xce, 0x81, 0x96, 0x81, 0xb7, 0x81, 0xce, 0x81, 0xce, 0x81, 0xce, 0x81, 0xce, 0x82, 0xce, 0x81, 0x92, 0x81, 0xbb, 0x81, 0xaf, 0xc7, 0x89, 0xc7, 0x89, 0xc7, 0x89, 0xc7, 0x89, 0xc7, 0xa3, 0x81, 0xce, 0x81, 0xce, 0x81, 0x9e, 0x81, 0xaf, 0x81, 0xc2, 0x1b, 0x81, 0xce, 0x81, 0xce, 0x81, 0xce, 0x81, 0xaf, 0x81, 0x9e, 0x81, 0xbd };
+static unsigned char frame_15[] PROGMEM = { 0x01, 0x80, 0xa1, 0x81, 0xa4, 0x81, 0xff, 0x80, 0xff, 0x80, 0xc6, 0x82, 0xcd, 0x82, 0xcd, 0x83, 0xcc, 0x82, 0xab, 0x81, 0xa1, 0x82, 0xcd, 0x82, 0xb3, 0x81, 0x99, 0x82, 0xcd, 0x11, 0x81, 0xaf, 0x81, 0x9c, 0x11, 0x81, 0xcc, 0x11, 0x81, 0xc9, 0x21, 0x11, 0x81, 0xc3, 0x17, 0x84, 0x9b, 0x81, 0xa7, 0x19, 0x11, 0x81, 0xc2, 0x1b, 0x83, 0xc0, 0x1d, 0x83, 0xbe, 0x2d, 0x84, 0xbd, 0x2d, 0x42, 0x81, 0xb9, 0x3d, 0x85, 0xb2, 0x18, 0x3d, 0x58, 0x81, 0xb2, 0x4b, 0x86, 0xbb, 0x59, 0x87, 0xbb, 0x67, 0x88, 0xbb, 0x75, 0x89, 0xb5, 0x15, 0x61, 0x8e, 0xbc, 0x41, 0x8e, 0xa1, 0x81, 0x9b, 0x31, 0x8f, 0xbc, 0x11, 0x11, 0x8f, 0xbc, 0x12, 0x90, 0xbc, 0x13, 0x11, 0x8b, 0x11, 0xbc, 0x13, 0x13, 0x8b, 0xbc, 0x13, 0x16, 0x87, 0xbd, 0x13, 0x81, 0xca, 0x13, 0x81, 0xca, 0x13, 0x81, 0xca, 0x13, 0x81, 0xca, 0x14, 0x81, 0xc9, 0x14, 0x81, 0xc9, 0x14, 0x81, 0xab, 0x81, 0x9d, 0x14, 0x81, 0x91, 0x81, 0xb7, 0x14, 0x81, 0xc9, 0x14, 0x81, 0xc9, 0x14, 0x81, 0xc9, 0x15, 0x81, 0xc8, 0x24, 0x81, 0xc9, 0x14, 0x1d, 0x81, 0x9b, 0xa0, 0x81, 0xab, 0xcb, 0x85, 0xcb, 0x85, 0xcb, 0x85, 0xcb, 0x85, 0xcb, 0x85, 0x90, 0x1d, 0x15, 0x81, 0xc8, 0x15, 0x81, 0xc8, 0x15, 0x81, 0x98, 0x81, 0xaf, 0x15, 0x81, 0xbc, 0x1b, 0x15, 0x81, 0xb8, 0x1f, 0x16, 0x81, 0xc7, 0x16, 0x81, 0xc7, 0x16, 0x81, 0xa8, 0x81, 0x9e, 0x16, 0x81, 0xb6 };
+static unsigned char frame_16[] PROGMEM = { 0x02, 0xcf, 0x11, 0x81, 0xff, 0x80, 0x9d, 0x13, 0x81, 0xff, 0x80, 0x9a, 0x17, 0x81, 0xff, 0x80, 0x97, 0x19, 0x81, 0xff, 0x80, 0x94, 0x1d, 0x81, 0xff, 0x80, 0x91, 0x1f, 0x81, 0xff, 0x0d, 0x82, 0x93, 0x81, 0xc1, 0x81, 0xc0, 0x53, 0x81, 0x95, 0x8a, 0xf5, 0x8b, 0x89, 0x1b, 0x8d, 0xf2, 0x8d, 0x93, 0x8f, 0xf0, 0x8f, 0x92, 0x8f, 0xf0, 0x8f, 0x92, 0x8f, 0xf1, 0x8d, 0x94, 0x8d, 0xe2, 0x81, 0x90, 0x8b, 0x97, 0x89, 0xf5, 0x12, 0x85, 0xa4, 0x81, 0xf2, 0x81, 0xad, 0x81, 0xef, 0x81, 0xb1, 0x81, 0xec, 0x81, 0xb3, 0x81, 0xa2, 0x81, 0xc6, 0x81, 0xb7, 0x81, 0xe6, 0x81, 0xb9, 0x81, 0x94, 0x81, 0xce, 0x81, 0xbd, 0x81, 0xe0, 0x81, 0xbf, 0x81, 0xa8, 0x81, 0xb4, 0x81, 0xc3, 0x81, 0xbc, 0x81, 0x9d, 0x81, 0xc5, 0x81, 0xac, 0x81, 0xaa, 0x81, 0xc7, 0x11, 0x81, 0xa9, 0x82, 0xa9, 0x81, 0x99, 0x81, 0xb1, 0x81, 0xa8, 0x82, 0xa7, 0x81, 0xcf, 0x81, 0xa6, 0x82, 0xa6, 0x81, 0xd1, 0x81, 0xcb, 0x81, 0xd5, 0x81, 0xc8, 0x1b, 0x81, 0xcb, 0x81, 0xc5, 0x81, 0xdb, 0x81, 0xb8, 0x19, 0x81, 0xdd, 0x81, 0xa0 };
+static unsigned char frame_17[] PROGMEM = { 0x03, 0x01, 0xa8, 0x03, 0x8b, 0x03, 0x60, 0xba, 0x03, 0xc2, 0x03, 0xc1, 0x03, 0x8a, 0x03, 0xa9, 0x03, 0xb7, 0x03, 0x30, 0xc5, 0x03, 0xc2, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0x98, 0x03, 0x9c, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc2, 0x03, 0xb4, 0x03, 0x02, 0x01, 0xba, 0x01, 0x04, 0xba, 0x01, 0x10, 0xba, 0x01, 0x40, 0xba, 0x01, 0x81, 0x01, 0xb3, 0x01, 0x81, 0x01, 0xb2, 0x01, 0x83, 0x01, 0xb1, 0x01, 0x83, 0x01, 0xb1, 0x01, 0x83, 0x01, 0xa4, 0x03, 0x40, 0x89, 0x01, 0xb1, 0x01, 0x83, 0x01, 0xb2, 0x01, 0x81, 0x01, 0xb3, 0x01, 0x81, 0x01, 0xb4, 0x01, 0x40, 0xbb, 0x01, 0x20, 0xbb, 0x07, 0x10, 0xba, 0x23, 0x08, 0xba, 0x03, 0xc2, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc2, 0x03, 0xb3, 0x03, 0x80, 0x03, 0xc2, 0x03, 0x8d, 0x03, 0x9b, 0x03, 0x30, 0xc5, 0x03, 0xc2, 0x03, 0xb4, 0x03, 0x40, 0x01, 0xc0, 0x03, 0xc2, 0x03, 0xae, 0x03, 0x85, 0x03, 0xc1, 0x03, 0xc2, 0x03, 0x90, 0x41, 0xa3, 0x03, 0x91, 0x41, 0xa3, 0x03, 0x91, 0x41, 0xa2, 0x03, 0x92, 0x41, 0xa1, 0x03, 0x93, 0x41, 0xa1, 0x03, 0x93, 0x41, 0xa0, 0x03, 0x94, 0x41, 0x9f, 0x03, 0x95, 0x41, 0x9f, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc2, 0x03, 0xc1, 0x03, 0xc2, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc2, 0x03, 0xc1, 0x03 };
+static unsigned char frame_18[] PROGMEM = { 0x04, 0x01, 0xa8, 0x03, 0x97, 0x03, 0xff, 0xe6, 0x03, 0xa9, 0x05, 0xb7, 0x03, 0xcc, 0x05, 0xb6, 0x03, 0xcd, 0x05, 0xc1, 0x05, 0x98, 0x03, 0x9c, 0x05, 0x8a, 0x03, 0xa9, 0x05, 0xc1, 0x0f, 0xc2, 0x1d, 0xb4, 0x03, 0x22, 0x09, 0xba, 0x11, 0x44, 0xba, 0x09, 0x10, 0x04, 0xb3, 0x09, 0x40, 0x10, 0xb3, 0x11, 0x81, 0x11, 0xb3, 0x09, 0x81, 0x21, 0xb2, 0x11, 0x83, 0x11, 0xb1, 0x09, 0x83, 0x11, 0xb1, 0x09, 0x83, 0x11, 0xa4, 0x03, 0x40, 0x04, 0x82, 0x11, 0xb1, 0x09, 0x83, 0x11, 0xab, 0x03, 0x05, 0x81, 0x21, 0xb3, 0x09, 0x81, 0x21, 0xb4, 0x05, 0x40, 0x20, 0xb4, 0x09, 0x20, 0x10, 0xb4, 0x0f, 0x10, 0x10, 0xb3, 0x1b, 0x08, 0x10, 0xb3, 0x33, 0x02, 0x08, 0xb4, 0x1b, 0x08, 0x02, 0xb3, 0x33, 0xc1, 0x33, 0xc2, 0x33, 0xb3, 0x03, 0x80, 0x33, 0xc2, 0x33, 0x8d, 0x03, 0x9b, 0x03, 0x30, 0x06, 0xbe, 0x63, 0xc2, 0x33, 0xb4, 0x03, 0x40, 0x31, 0xba, 0x43, 0x31, 0xc1, 0x33, 0xae, 0x03, 0x85, 0x63, 0xc1, 0x63, 0x90, 0x01, 0x10, 0x9d, 0x63, 0x96, 0x21, 0x9d, 0x63, 0x97, 0x21, 0x9d, 0x63, 0x97, 0x21, 0x84, 0x03, 0x86, 0x33, 0x0c, 0x95, 0x21, 0x9b, 0x43, 0x01, 0x92, 0x21, 0x9b, 0x63, 0x03, 0x92, 0x21, 0x9a, 0x43, 0x01, 0x93, 0x21, 0x99, 0x43, 0x01, 0x94, 0x21, 0x99, 0x43, 0x01, 0xba, 0x43, 0x01, 0xba, 0x03, 0x03, 0xbb, 0x43, 0x01, 0xba, 0x43, 0x02, 0xbb, 0x43, 0x01, 0xba, 0x03, 0x03, 0xba, 0x03, 0x03, 0xbb, 0x03, 0x03, 0xba, 0x03, 0x03 };
+static unsigned char frame_19[] PROGMEM = { 0x05, 0xc8, 0x05, 0xff, 0x8b, 0x1b, 0xff, 0x8b, 0x63, 0xa8, 0x03, 0xb2, 0x03, 0x9c, 0x43, 0x02, 0xff, 0x84, 0x03, 0x06, 0xff, 0x84, 0x03, 0x18, 0xff, 0x84, 0x03, 0x30, 0xd1, 0x01, 0x01, 0xa4, 0x03, 0x40, 0x01, 0xa2, 0x01, 0x10, 0x91, 0x01, 0x40, 0xa6, 0x03, 0x81, 0x03, 0x8a, 0x03, 0x88, 0x01, 0x81, 0x01, 0x89, 0x01, 0x83, 0x01, 0x9e, 0x03, 0x82, 0x03, 0x9d, 0x01, 0x85, 0x01, 0x86, 0x01, 0x85, 0x01, 0x9c, 0x03, 0x84, 0x03, 0x9b, 0x01, 0x87, 0x01, 0x84, 0x01, 0x87, 0x01, 0x9a, 0x03, 0x85, 0x03, 0x89, 0x03, 0x84, 0x01, 0x87, 0x01, 0x84, 0x01, 0x87, 0x01, 0x99, 0x03, 0x87, 0x03, 0x9a, 0x01, 0x87, 0x01, 0x84, 0x01, 0x87, 0x01, 0x98, 0x03, 0x89, 0x03, 0x99, 0x01, 0x87, 0x01, 0x85, 0x01, 0x85, 0x01, 0x98, 0x03, 0x8b, 0x03, 0x99, 0x01, 0x85, 0x01, 0x87, 0x01, 0x83, 0x01, 0x99, 0x03, 0x8c, 0x03, 0x9a, 0x01, 0x81, 0x01, 0x8b, 0x01, 0x40, 0xa0, 0x03, 0x8e, 0x03, 0x8e, 0x03, 0x40, 0x83, 0x01, 0x90, 0x01, 0x01, 0x9c, 0x03, 0x8f, 0x03, 0xf4, 0x03, 0x91, 0x03, 0xf2, 0x03, 0x93, 0x03, 0xf0, 0x03, 0x95, 0x03, 0xef, 0x03, 0x96, 0x03, 0xed, 0x03, 0x40, 0x01, 0x8a, 0x03, 0x9f, 0x01, 0x92, 0x01, 0x9e, 0x03, 0x99, 0x03, 0x9f, 0x01, 0x92, 0x01, 0x9d, 0x03, 0x9b, 0x03, 0x9e, 0x01, 0x92, 0x01, 0x0c, 0x95, 0x03, 0x9d, 0x03, 0x9d, 0x01, 0x92, 0x01, 0x9c, 0x03, 0x9e, 0x03, 0x60, 0x95, 0x01, 0x92, 0x01, 0x9b, 0x03, 0xa0, 0x03, 0xe3, 0x03, 0xa2, 0x03, 0xe1, 0x03, 0xa3, 0x03, 0xe0, 0x03, 0xa5, 0x03, 0xde, 0x03, 0xa7, 0x03 };
+static unsigned char frame_20[] PROGMEM = { 0x06, 0x00, 0xff, 0x6e, 0x20, 0xff, 0x21, 0x6f, 0x22, 0x46, 0xff, 0x00, 0x00, 0x10, 0x00, 0x01, 0x31, 0x20, 0x00, 0x7c, 0x84, 0xc7, 0x19, 0x00, 0x02, 0xe5, 0xb2, 0x18, 0x12, 0x02, 0x1b, 0x78, 0x10, 0x0e, 0x1d, 0x3a, 0x74, 0xe9, 0xd3, 0xa7, 0x5e, 0x80, 0x3d, 0x3d, 0x86, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x86, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x86, 0x38, 0xa3, 0x86, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x86, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x86, 0x38, 0xa3, 0x86, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x86, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x86, 0x38, 0xa3, 0x86, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x86, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x86, 0x38, 0xa3, 0x86, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x86, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x86, 0x38, 0xa3, 0x86, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x86, 0x38, 0x63, 0x8a, 0x38, 0x63, 0x86, 0x3e, 0xe3, 0xd7, 0x6a, 0x64, 0x8e, 0x6e, 0x70, 0xcf, 0x5a, 0xd3, 0x53, 0x1d, 0x35, 0xda, 0x94, 0x7c, 0xf2, 0x48, 0x80 };
+static unsigned char frame_21[] PROGMEM = { 0x00, 0xb3, 0x81, 0x9b, 0x81, 0xcf, 0x81, 0xcf, 0x1a, 0x81, 0xc3, 0x81, 0xcf, 0x18, 0x81, 0xc6, 0x81, 0xcf, 0x81, 0xcf, 0x81, 0xce, 0x81, 0xcf, 0x17, 0x81, 0xc7, 0x81, 0xcf, 0x81, 0xcf, 0x81, 0xcf, 0x81, 0x96, 0x85, 0xb3, 0x81, 0x95, 0x89, 0xb1, 0x81, 0x94, 0x8b, 0xb0, 0x81, 0x93, 0x8d, 0xaf, 0x81, 0x93, 0x8d, 0xaf, 0x81, 0x92, 0x8f, 0xad, 0x81, 0x93, 0x8f, 0xad, 0x81, 0x93, 0x8f, 0xad, 0x81, 0x93, 0x8f, 0xad, 0x81, 0x93, 0x8f, 0xad, 0x18, 0x1b, 0x8d, 0xad, 0x81, 0x95, 0x8d, 0xad, 0x81, 0x96, 0x8b, 0xae, 0x81, 0x97, 0x89, 0xaf, 0x81, 0x99, 0x85, 0xb1, 0x81, 0xce, 0x81, 0xcf, 0x81, 0xcf, 0x81, 0xcf, 0x81, 0xcf, 0x81, 0xcf, 0x81, 0xce, 0x81, 0xcf, 0x81, 0xcf, 0x81, 0xcf, 0x81, 0xcf, 0x81, 0x96, 0x81, 0xb7, 0x81, 0xcf, 0x81, 0xcf, 0x81, 0xcf, 0x81, 0xcf, 0x81, 0xce, 0x81, 0xcf, 0x81, 0xcf, 0x81, 0xa5, 0x81, 0xa9, 0x81, 0xcf, 0x19, 0x9a, 0xab, 0x1a, 0x9a, 0xab, 0x1a, 0x9a, 0xab, 0x1a, 0x9a, 0xab, 0x1a, 0x9a, 0xab, 0x81, 0xcf, 0x81, 0xce, 0x81, 0xcf, 0x81, 0xcf, 0x81, 0xcf, 0x81, 0xcf, 0x81, 0xce, 0x81, 0x99, 0x81, 0xb5, 0x81, 0xca, 0x11, 0x12, 0x1c };
+static unsigned char frame_22[] PROGMEM = { 0x01, 0xb3, 0x81, 0xff, 0x80, 0xc7, 0x81, 0xc3, 0x82, 0xce, 0x27, 0x81, 0xc6, 0x82, 0xce, 0x82, 0xff, 0x80, 0x9e, 0x82, 0xc0, 0x1d, 0x26, 0x81, 0xc7, 0x82, 0xce, 0x82, 0xce, 0x82, 0xce, 0x82, 0x95, 0x41, 0x84, 0xaf, 0x11, 0x81, 0x93, 0x45, 0x84, 0xad, 0x11, 0x81, 0x92, 0x47, 0x84, 0xac, 0x11, 0x81, 0x91, 0x49, 0x84, 0xab, 0x11, 0x16, 0x1a, 0x3a, 0x85, 0xaa, 0x11, 0x81, 0x90, 0x4b, 0x84, 0xa9, 0x11, 0x81, 0x91, 0x3c, 0x85, 0xa8, 0x11, 0x81, 0x91, 0x3c, 0x85, 0xa8, 0x11, 0x81, 0x91, 0x3c, 0x85, 0xa8, 0x11, 0x81, 0x91, 0x3c, 0x85, 0xa8, 0x11, 0x16, 0x1b, 0x2b, 0x86, 0xa7, 0x12, 0x81, 0x92, 0x3a, 0x85, 0x92, 0x81, 0x95, 0x12, 0x14, 0x1e, 0x29, 0x86, 0xa8, 0x12, 0x82, 0x93, 0x27, 0x86, 0xa9, 0x12, 0x81, 0x96, 0x14, 0x87, 0xaa, 0x12, 0x81, 0x98, 0x89, 0xaa, 0x13, 0x81, 0x9a, 0x85, 0xac, 0x13, 0x81, 0xbf, 0x1b, 0x13, 0x81, 0xcb, 0x12, 0x81, 0xcc, 0x12, 0x81, 0x96, 0x81, 0xb5, 0x12, 0x81, 0xcb, 0x13, 0x81, 0xcb, 0x13, 0x81, 0xcb, 0x13, 0x81, 0xcb, 0x13, 0x81, 0xc3, 0x17, 0x13, 0x81, 0x92, 0x81, 0xb7, 0x14, 0x81, 0xca, 0x14, 0x81, 0xca, 0x14, 0x81, 0xca, 0x14, 0x81, 0xca, 0x14, 0x81, 0xc9, 0x14, 0x81, 0xca, 0x14, 0x81, 0xca, 0x14, 0x81, 0xa0, 0x81, 0xa9, 0x14, 0x14, 0x9f, 0xa7, 0x14, 0x81, 0x9e, 0x85, 0xa6, 0x15, 0x81, 0x9e, 0x85, 0xa6, 0x15, 0x81, 0x9e, 0x85, 0xa6, 0x15, 0x81, 0x9e, 0x85, 0xa6, 0x15, 0x81, 0x9e, 0x85, 0xa6, 0x15, 0x81, 0xc9, 0x15, 0x81, 0xc8, 0x16, 0x81, 0xc8, 0x15, 0x81, 0xc9, 0x15, 0x81, 0xc9, 0x15, 0x81, 0xc9, 0x15, 0x81, 0xc8, 0x16, 0x81, 0x92, 0x81, 0xb5, 0x16, 0x81, 0xc3, 0x11, 0x12, 0x16, 0x15 };
+static unsigned char frame_23[] PROGMEM = { 0x02, 0x80, 0xcf, 0x11, 0x81, 0xff, 0x80, 0x9b, 0x26, 0x81, 0xff, 0x80, 0x96, 0x1b, 0x81, 0xff, 0x80, 0x91, 0x82, 0x90, 0x81, 0xef, 0x81, 0x9b, 0x81, 0x95, 0x81, 0xff, 0x08, 0x81, 0x99, 0x82, 0xff, 0x02, 0x81, 0x98, 0x16, 0x81, 0xdb, 0x85, 0x9d, 0x1e, 0x81, 0x94, 0x82, 0x99, 0x89, 0xb2, 0x8d, 0x96, 0x81, 0xa9, 0x81, 0x94, 0x8f, 0x8a, 0x81, 0xa3, 0x8f, 0x93, 0x81, 0xad, 0x82, 0x90, 0x91, 0xac, 0x91, 0x8a, 0x14, 0x81, 0xb3, 0x1d, 0x93, 0xaa, 0x93, 0x8c, 0x81, 0xb7, 0x2a, 0x93, 0xaa, 0x93, 0x89, 0x81, 0xbd, 0x18, 0x93, 0xab, 0x91, 0x88, 0x81, 0xc1, 0x26, 0x91, 0xad, 0x8f, 0x61, 0xc7, 0x15, 0x8f, 0xaf, 0x8d, 0x51, 0xcb, 0x16, 0x89, 0xb6, 0x56, 0x82, 0xd0, 0x81, 0xcb, 0x81, 0xd5, 0x81, 0xc6, 0x2f, 0x81, 0xca, 0x81, 0xc1, 0x81, 0xdf, 0x81, 0xbc, 0x82, 0xe4, 0x81, 0xb7, 0x81, 0xe9, 0x81, 0xb2, 0x82, 0xee, 0x81, 0xad, 0x81, 0xf3, 0x81, 0x95, 0xa4, 0xd8, 0xc8, 0x8b, 0x81, 0x92, 0x81, 0x9e, 0x81, 0x9a, 0xc8, 0xb4, 0x81, 0xa3, 0xc8, 0xf0, 0x81, 0x95, 0x81, 0xff, 0x0c, 0x2f, 0x18, 0x81, 0xff, 0x09, 0x1b, 0x81, 0xff, 0x80, 0x96, 0x25, 0x81, 0xff, 0x80, 0x9c, 0x11 };
+static unsigned char frame_24[] PROGMEM = { 0x03, 0xc8, 0x03, 0xc1, 0x03, 0xa9, 0x03, 0x8a, 0x03, 0xc1, 0x03, 0xc0, 0x1d, 0xc1, 0x03, 0xbd, 0x33, 0xc5, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc0, 0x05, 0xc1, 0x03, 0xa1, 0x01, 0x01, 0x8b, 0x03, 0xa0, 0x01, 0x10, 0x8c, 0x03, 0xa0, 0x01, 0x40, 0x8c, 0x03, 0xa0, 0x01, 0x81, 0x01, 0x84, 0x03, 0xa0, 0x01, 0x83, 0x01, 0x82, 0x03, 0xa0, 0x01, 0x85, 0x01, 0x80, 0x03, 0xa1, 0x01, 0x85, 0x01, 0x20, 0x01, 0xa0, 0x01, 0x87, 0x0d, 0x18, 0xa6, 0x01, 0x87, 0x01, 0x0c, 0xa6, 0x01, 0x87, 0x01, 0x06, 0xa6, 0x01, 0x87, 0x01, 0x03, 0xa6, 0x01, 0x87, 0x41, 0x01, 0xa6, 0x01, 0x87, 0x61, 0xad, 0x01, 0x87, 0x31, 0xae, 0x01, 0x85, 0x29, 0xaf, 0x01, 0x85, 0x0d, 0xb0, 0x01, 0x83, 0x0d, 0xb2, 0x01, 0x81, 0x0d, 0xb4, 0x01, 0x40, 0x06, 0xb5, 0x01, 0x50, 0x01, 0xb6, 0x01, 0x19, 0xc3, 0x05, 0xc1, 0x03, 0xc1, 0x03, 0x98, 0x03, 0x9b, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xae, 0x03, 0x85, 0x03, 0xc1, 0x03, 0x83, 0x03, 0xaf, 0x05, 0xc1, 0x03, 0xc1, 0x03, 0xbe, 0x1b, 0xaa, 0x01, 0x9b, 0x01, 0x99, 0x01, 0x9b, 0x01, 0x99, 0x01, 0x9b, 0x01, 0x99, 0x01, 0x9b, 0x01, 0x99, 0x01, 0x9b, 0x01, 0x99, 0x01, 0x9b, 0x01, 0x99, 0x01, 0x9b, 0x01, 0x99, 0x01, 0x9b, 0x01, 0xaa, 0x03, 0xc1, 0x03, 0x98, 0x03, 0x9b, 0x03, 0xc1, 0x03, 0xc0, 0x05, 0xc1, 0x03, 0xc1, 0x03, 0xc1, 0x03, 0xc1, 0x03 };
+static unsigned char frame_25[] PROGMEM = { 0x04, 0xff, 0xc8, 0x03, 0xc5, 0x03, 0xd4, 0x1b, 0xc1, 0x05, 0xbd, 0x53, 0xc5, 0x05, 0xc1, 0x05, 0xc1, 0x05, 0xc1, 0x05, 0xc1, 0x05, 0xc0, 0x09, 0xc1, 0x0f, 0xa6, 0x05, 0x8d, 0x0f, 0xa0, 0x03, 0x12, 0x8c, 0x0f, 0xa0, 0x03, 0x48, 0x8c, 0x17, 0xa0, 0x03, 0x20, 0x02, 0x85, 0x0f, 0xa0, 0x03, 0x80, 0x09, 0x85, 0x0f, 0xa0, 0x05, 0x81, 0x11, 0x84, 0x0f, 0xa1, 0x05, 0x81, 0x11, 0x82, 0x1d, 0xa2, 0x09, 0x82, 0x21, 0x03, 0x36, 0xa4, 0x09, 0x82, 0x21, 0x80, 0x1b, 0xa4, 0x11, 0x81, 0x41, 0x80, 0x1b, 0xa5, 0x21, 0x80, 0x01, 0x01, 0x1b, 0xa6, 0x41, 0x40, 0x80, 0x41, 0x0d, 0xa6, 0x01, 0x21, 0x80, 0x61, 0x06, 0xa6, 0x01, 0x87, 0x31, 0x03, 0xa7, 0x01, 0x85, 0x29, 0x03, 0xa8, 0x01, 0x85, 0x4d, 0x01, 0xa9, 0x19, 0x83, 0x4d, 0x01, 0x9e, 0x03, 0x40, 0x87, 0x4d, 0x01, 0xad, 0x01, 0x40, 0x56, 0xb5, 0x01, 0x50, 0x0d, 0xb6, 0x01, 0x59, 0x01, 0xbc, 0x35, 0xa6, 0x03, 0x8d, 0x33, 0xc1, 0x33, 0x98, 0x03, 0x9b, 0x33, 0xc1, 0x33, 0xc1, 0x33, 0x93, 0x03, 0x8d, 0x03, 0x85, 0x33, 0xc1, 0x33, 0x83, 0x03, 0xaf, 0x65, 0xc1, 0x63, 0xc1, 0x63, 0x87, 0x03, 0x91, 0x01, 0x8a, 0x1b, 0x88, 0x01, 0xbd, 0x21, 0xc2, 0x21, 0xc2, 0x21, 0xc2, 0x21, 0x8f, 0x03, 0xa5, 0x21, 0xc2, 0x21, 0x0c, 0x0c, 0xb4, 0x21, 0xc2, 0x21, 0x90, 0x03, 0x8c, 0x43, 0x01, 0xba, 0x43, 0x01, 0x91, 0x03, 0x9b, 0x43, 0x01, 0xba, 0x43, 0x01, 0xb9, 0x05, 0x03, 0xba, 0x03, 0x03, 0xba, 0x03, 0x03, 0xba, 0x03, 0x03, 0xba, 0x03, 0x03, 0x87, 0x03 };
+static unsigned char frame_26[] PROGMEM = { 0x05, 0x01, 0xc1, 0x0f, 0xff, 0x8a, 0x43, 0x01, 0xff, 0x83, 0x03, 0x18, 0xff, 0x84, 0x03, 0x60, 0xff, 0x83, 0x43, 0x01, 0x0c, 0x95, 0x03, 0xdf, 0x03, 0x86, 0x03, 0x96, 0x03, 0xd8, 0x03, 0x8a, 0x03, 0xd9, 0x21, 0x91, 0x03, 0x8e, 0x03, 0x8a, 0x01, 0x04, 0xb5, 0x01, 0x10, 0x8c, 0x03, 0x90, 0x03, 0x87, 0x01, 0x40, 0xb6, 0x01, 0x40, 0x8b, 0x03, 0x94, 0x03, 0x84, 0x01, 0x81, 0x01, 0xae, 0x01, 0x81, 0x01, 0x82, 0x03, 0x98, 0x03, 0x82, 0x01, 0x81, 0x01, 0xae, 0x01, 0x81, 0x01, 0x80, 0x03, 0x9c, 0x03, 0x80, 0x01, 0x81, 0x01, 0xaf, 0x01, 0x40, 0x85, 0x03, 0x86, 0x03, 0x8c, 0x03, 0x40, 0x85, 0x01, 0x90, 0x03, 0x93, 0x01, 0x10, 0x82, 0x03, 0xa3, 0x03, 0x80, 0x01, 0x04, 0xb8, 0x21, 0x85, 0x03, 0xa6, 0x03, 0xac, 0x03, 0xa2, 0x03, 0xaa, 0x03, 0xd8, 0x03, 0xae, 0x03, 0xd4, 0x03, 0xb2, 0x03, 0xd0, 0x03, 0xb5, 0x03, 0x9d, 0x03, 0xa3, 0x03, 0xb8, 0x03, 0xa1, 0x03, 0x9b, 0x03, 0xbc, 0x03, 0xc6, 0x03, 0xc0, 0x03, 0xc2, 0x03, 0xb8, 0x01, 0xd8, 0x01, 0xac, 0x01, 0xd8, 0x01, 0xac, 0x01, 0xd8, 0x01, 0xac, 0x01, 0xd8, 0x01, 0xac, 0x01, 0xd8, 0x01, 0xc1, 0x03, 0xac, 0x03, 0x8e, 0x03, 0xba, 0x33, 0xad, 0x03, 0xdc, 0x03, 0xa6, 0x03, 0x90, 0x03, 0xc2, 0x03, 0xa2, 0x03, 0xe4, 0x03 };
+static unsigned char frame_27[] PROGMEM = { 0x06, 0x00, 0xff, 0xff, 0x20, 0xff, 0x21, 0x46, 0x22, 0x47, 0xff, 0x27, 0x0e, 0x1d, 0x13, 0x62, 0x74, 0x4d, 0x89, 0xd1, 0x36, 0x27, 0x44, 0xd8, 0x00, 0x2c, 0x10, 0x03, 0x1c, 0x5f, 0xa4, 0xe8, 0x53, 0x88, 0x04, 0xf8, 0x80, 0x1d, 0x3f, 0x8a, 0x38, 0xa3, 0x86, 0x38, 0xa3, 0x8a, 0x38, 0xa3, 0x8a, 0x3b, 0xa2, 0xa3, 0xf8, 0x63, 0x8a, 0x38, 0xa3, 0x8a, 0x38, 0xa3, 0x86, 0x38, 0xa3, 0x8a, 0x38, 0xa3, 0x8a, 0x38, 0x63, 0x8a, 0x38, 0xa3, 0x8a, 0x38, 0xa3, 0x86, 0x38, 0xa3, 0x8a, 0x38, 0xa3, 0x8a, 0x38, 0x63, 0x8a, 0x38, 0xa3, 0x8a, 0x38, 0xa3, 0x86, 0x38, 0xa3, 0x8a, 0x38, 0xa3, 0x86, 0x38, 0xa3, 0x8a, 0x38, 0xa3, 0x8a, 0x38, 0x63, 0x8a, 0x38, 0xa3, 0x8a, 0x38, 0xa3, 0x86, 0x38, 0xa3, 0x8a, 0x3b, 0xce, 0x0e, 0xef, 0xc7, 0x18, 0xf3, 0x8f, 0xfa, 0x68, 0xbe, 0x60 };
+
+static unsigned char* frames[] PROGMEM = { frame_0, frame_1, frame_2, frame_3, frame_4, frame_5, frame_6, frame_7, frame_8, frame_9, frame_10, frame_11, frame_12, frame_13, frame_14, frame_15, frame_16, frame_17, frame_18, frame_19, frame_20, frame_21, frame_22, frame_23, frame_24, frame_25, frame_26, frame_27 };
+
+static size_t frame_sizes[] PROGMEM = { sizeof(frame_0), sizeof(frame_1), sizeof(frame_2), sizeof(frame_3), sizeof(frame_4), sizeof(frame_5), sizeof(frame_6), sizeof(frame_7), sizeof(frame_8), sizeof(frame_9), sizeof(frame_10), sizeof(frame_11), sizeof(frame_12), sizeof(frame_13), sizeof(frame_14), sizeof(frame_15), sizeof(frame_16), sizeof(frame_17), sizeof(frame_18), sizeof(frame_19), sizeof(frame_20), sizeof(frame_21), sizeof(frame_22), sizeof(frame_23), sizeof(frame_24), sizeof(frame_25), sizeof(frame_26), sizeof(frame_27) };
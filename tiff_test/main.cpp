@@ -1,22 +1,53 @@
+#include <GainStage.h>
 #include <SRLV.h>
 #include <Span.h>
+#include <YieldBudget.h>
+#include <algorithm>
+#include <array>
 #include <bit>
+#include <chrono>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <stdint.h>
+#include <vector>
 
 #define PROGMEM
 
+// Small synthetic video with every compression mode, which the golden checksums belong to.
+namespace fixture {
+#include "fixture.h"
+}
+
+// The benchmarks use the full video if it has been encoded locally; it's too large to be part of the repository.
+#if __has_include("../bad_apple.h")
 #include "../bad_apple.h"
+#else
+using fixture::frame_sizes;
+using fixture::frames;
+#endif
 
 constexpr int IMAGE_WIDTH = 80;
 constexpr int IMAGE_HEIGHT = 64;
-constexpr int PIXEL_COUNT = IMAGE_WIDTH * IMAGE_HEIGHT;
 constexpr size_t ROW_SIZE = IMAGE_WIDTH / 8;
+constexpr size_t FRAME_SIZE = SRLV::frame_size<IMAGE_WIDTH, IMAGE_HEIGHT>;
+constexpr size_t FRAME_COUNT = sizeof(frames) / sizeof(*frames);
+constexpr size_t FIXTURE_FRAME_COUNT = sizeof(fixture::frames) / sizeof(*fixture::frames);
+// how often the entire video is decoded per benchmark
+constexpr int BENCHMARK_ROUNDS = 20;
+// stereo samples per gain stage benchmark, about 24 seconds at 44.1kHz
+constexpr uint32_t GAIN_BENCHMARK_SAMPLES = 1 << 20;
+// Per-frame checksums of the fixture's source frames, written by make_fixture.py together with fixture.h.
+constexpr char const* GOLDEN_CHECKSUMS_PATH = GOLDEN_CHECKSUMS_FILE;
 
-void print_xbm(Span<uint8_t> xbm_data)
+using Clock = std::chrono::steady_clock;
+
+void print_xbm(Span<uint8_t const> xbm_data)
 {
 	auto x = 0;
 	auto y = 0;
@@ -29,13 +60,424 @@ void print_xbm(Span<uint8_t> xbm_data)
 			std::cout << std::endl;
 		}
 	}
-	std::cout << std::endl
+	std::cout << std::dec << std::endl
 			  << y << std::endl;
 	std::cout << xbm_data.size() << std::endl;
 }
 
-int main()
+// FNV-1a hash of the frame's pixels.
+uint32_t frame_checksum(Span<uint8_t const> frame)
+{
+	uint32_t hash = 2166136261u;
+	for (size_t i = 0; i < FRAME_SIZE; ++i)
+		hash = (hash ^ frame[i]) * 16777619u;
+	return hash;
+}
+
+// Decodes the whole fixture in order, each frame relative to its predecessor, and returns every frame's checksum.
+std::vector<uint32_t> decode_checksums()
+{
+	std::vector<uint32_t> checksums;
+	std::vector<uint8_t> image(FRAME_SIZE);
+	for (size_t i = 0; i < FIXTURE_FRAME_COUNT; ++i) {
+		SRLV::decompress_into<IMAGE_WIDTH, IMAGE_HEIGHT>(image, { fixture::frames[i], fixture::frame_sizes[i] }, image);
+		checksums.push_back(frame_checksum(image));
+	}
+	return checksums;
+}
+
+// Returns whether all frames decode to the golden checksums.
+bool verify_golden()
+{
+	std::ifstream file(GOLDEN_CHECKSUMS_PATH);
+	std::vector<uint32_t> golden;
+	uint32_t checksum;
+	while (file >> std::hex >> checksum)
+		golden.push_back(checksum);
+	if (golden.size() != FIXTURE_FRAME_COUNT) {
+		std::cout << "golden checksums: expected " << FIXTURE_FRAME_COUNT << " frames, " << GOLDEN_CHECKSUMS_PATH << " has " << golden.size() << std::endl;
+		return false;
+	}
+
+	auto const checksums = decode_checksums();
+	size_t mismatches = 0;
+	for (size_t i = 0; i < FIXTURE_FRAME_COUNT; ++i) {
+		if (checksums[i] == golden[i])
+			continue;
+		// later frames usually only mismatch because of broken predecessors
+		if (mismatches < 10)
+			std::cout << "golden checksums: frame " << std::dec << i << " (mode " << static_cast<int>(fixture::frames[i][0]) << ") mismatches" << std::endl;
+		++mismatches;
+	}
+	std::cout << "golden checksums: " << std::dec << FIXTURE_FRAME_COUNT - mismatches << "/" << FIXTURE_FRAME_COUNT << " frames ok" << std::endl;
+	return mismatches == 0;
+}
+
+// Runs the gain stage over a synthetic stereo signal, like SampleCounterOutput does, and prints the time per sample.
+void benchmark_gain_stage(char const* name, GainStage& gain)
+{
+	std::vector<int16_t> input(GAIN_BENCHMARK_SAMPLES * 2);
+	for (size_t i = 0; i < input.size(); ++i)
+		input[i] = static_cast<int16_t>(i * 7919);
+
+	uint32_t checksum = 0;
+	auto start = Clock::now();
+	for (uint32_t i = 0; i < GAIN_BENCHMARK_SAMPLES; ++i) {
+		int16_t sample[2] = { input[2 * i], input[2 * i + 1] };
+		gain.apply(sample);
+		gain.advance();
+		checksum += static_cast<uint16_t>(sample[0]) ^ static_cast<uint16_t>(sample[1]);
+	}
+	auto end = Clock::now();
+
+	auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+	auto per_sample = static_cast<double>(nanoseconds) / GAIN_BENCHMARK_SAMPLES;
+	std::cout << std::left << std::setw(12) << name << std::right << std::fixed << std::setprecision(2)
+			  << std::setw(10) << per_sample << " ns/sample (checksum " << checksum << ")" << std::endl;
+}
+
+// Returns whether all frames pass validation, which allows decoding them without bounds checks.
+bool validate_frames()
+{
+	size_t invalid_count = 0;
+	for (size_t i = 0; i < FRAME_COUNT; ++i) {
+		if (SRLV::validate_frame({ frames[i], frame_sizes[i] }, IMAGE_WIDTH * IMAGE_HEIGHT))
+			continue;
+		if (invalid_count < 10)
+			std::cout << "validation: frame " << i << " (mode " << static_cast<int>(frames[i][0]) << ") is invalid" << std::endl;
+		++invalid_count;
+	}
+	return invalid_count == 0;
+}
+
+// Decodes the video like VideoPlayer used to: a new vector per frame, which is then copied into the last frame.
+uint32_t decode_allocating()
+{
+	uint32_t checksum = 0;
+	std::vector<uint8_t> last_frame(FRAME_SIZE);
+	for (size_t i = 0; i < FRAME_COUNT; ++i) {
+		auto decompressed = SRLV::decompress<IMAGE_WIDTH, IMAGE_HEIGHT>({ frames[i], frame_sizes[i] }, last_frame);
+		checksum += decompressed[i % FRAME_SIZE];
+		last_frame = decompressed;
+	}
+	return checksum;
+}
+
+// Decodes the video into two fixed buffers that are swapped after every frame.
+uint32_t decode_ping_pong()
+{
+	uint32_t checksum = 0;
+	alignas(uint32_t) static std::array<std::array<uint8_t, (FRAME_SIZE + 3) & ~3>, 2> buffers {};
+	size_t current = 0;
+	for (size_t i = 0; i < FRAME_COUNT; ++i) {
+		auto& output = buffers[current];
+		auto const& previous = buffers[1 - current];
+		SRLV::decompress_into<IMAGE_WIDTH, IMAGE_HEIGHT>({ output.data(), output.size() }, { frames[i], frame_sizes[i] }, { previous.data(), previous.size() });
+		checksum += output[i % FRAME_SIZE];
+		current = 1 - current;
+	}
+	return checksum;
+}
+
+// Same as decode_ping_pong, but without bounds checks, which is how VideoPlayer decodes validated videos.
+uint32_t decode_validated()
+{
+	uint32_t checksum = 0;
+	alignas(uint32_t) static std::array<std::array<uint8_t, (FRAME_SIZE + 3) & ~3>, 2> buffers {};
+	size_t current = 0;
+	for (size_t i = 0; i < FRAME_COUNT; ++i) {
+		auto& output = buffers[current];
+		auto const& previous = buffers[1 - current];
+		SRLV::decompress_validated_into<IMAGE_WIDTH, IMAGE_HEIGHT>({ output.data(), output.size() }, { frames[i], frame_sizes[i] }, { previous.data(), previous.size() });
+		checksum += output[i % FRAME_SIZE];
+		current = 1 - current;
+	}
+	return checksum;
+}
+
+// Same as decode_ping_pong, but additionally converts every frame to the display's tile layout like VideoPlayer does.
+uint32_t decode_to_tiles()
+{
+	uint32_t checksum = 0;
+	alignas(uint32_t) static std::array<std::array<uint8_t, (FRAME_SIZE + 3) & ~3>, 2> buffers {};
+	static std::array<uint8_t, IMAGE_WIDTH * IMAGE_HEIGHT / 8> tiles {};
+	size_t current = 0;
+	for (size_t i = 0; i < FRAME_COUNT; ++i) {
+		auto& output = buffers[current];
+		auto const& previous = buffers[1 - current];
+		SRLV::decompress_into<IMAGE_WIDTH, IMAGE_HEIGHT>({ output.data(), output.size() }, { frames[i], frame_sizes[i] }, { previous.data(), previous.size() });
+		SRLV::frame_to_tiles({ tiles.data(), tiles.size() }, IMAGE_WIDTH, { output.data(), output.size() }, IMAGE_WIDTH, 0, IMAGE_HEIGHT / 8);
+		checksum += tiles[i % tiles.size()];
+		current = 1 - current;
+	}
+	return checksum;
+}
+
+// pgm_read_byte as the ESP8266 implements it for flash: an aligned word load and a shift for every byte.
+uint8_t flash_read_byte(uint8_t const* address)
+{
+	auto const offset = reinterpret_cast<FlatPtr>(address) % sizeof(uint32_t);
+	uint32_t word;
+	std::memcpy(&word, address - offset, sizeof(word));
+	return static_cast<uint8_t>(word >> (8 * offset));
+}
+
+// Sums all compressed bytes like the decoders used to read them.
+uint32_t read_bytewise()
+{
+	uint32_t sum = 0;
+	for (size_t i = 0; i < FRAME_COUNT; ++i) {
+		for (size_t j = 0; j < frame_sizes[i]; ++j)
+			sum += flash_read_byte(frames[i] + j);
+	}
+	return sum;
+}
+
+// Sums all compressed bytes with ProgmemReader, which loads every word once.
+uint32_t read_wordwise()
 {
-	auto image = SRLV::decompress({ frame_1910, sizeof(frame_1910) }, IMAGE_WIDTH * IMAGE_HEIGHT, { });
-	print_xbm(image);
+	uint32_t sum = 0;
+	for (size_t i = 0; i < FRAME_COUNT; ++i) {
+		ProgmemReader reader { { frames[i], frame_sizes[i] } };
+		while (!reader.is_at_end())
+			sum += reader.read_byte();
+	}
+	return sum;
+}
+
+// Writes every compressed byte as a run of up to 31 pixels with alternating colors, and fills the rest of the frame,
+// one pixel at a time.
+uint32_t write_runs_bitwise()
+{
+	alignas(uint32_t) static std::array<uint8_t, FRAME_SIZE> frame {};
+	uint32_t checksum = 0;
+	for (size_t i = 0; i < FRAME_COUNT; ++i) {
+		frame.fill(0);
+		size_t position = 0;
+		uint8_t color = 0;
+		auto write_pixel = [&] {
+			if (color == 1)
+				frame[position / 8] |= 1 << (position % 8);
+			++position;
+		};
+		for (size_t j = 0; j < frame_sizes[i]; ++j) {
+			for (auto length = frames[i][j] % 32; length > 0 && position < FRAME_SIZE * 8; --length)
+				write_pixel();
+			color = 1 - color;
+		}
+		while (position < FRAME_SIZE * 8)
+			write_pixel();
+		checksum += frame[i % frame.size()];
+	}
+	return checksum;
+}
+
+// The same runs, written with BitWriter.
+uint32_t write_runs_word_wise()
+{
+	alignas(uint32_t) static std::array<uint8_t, FRAME_SIZE> frame {};
+	uint32_t checksum = 0;
+	for (size_t i = 0; i < FRAME_COUNT; ++i) {
+		BitWriter<BitOrder::LsbFirst> writer { { frame.data(), frame.size() } };
+		uint8_t color = 0;
+		for (size_t j = 0; j < frame_sizes[i]; ++j) {
+			writer.write_run(color, frames[i][j] % 32);
+			color = 1 - color;
+		}
+		writer.fill_to_end(color);
+		checksum += frame[i % frame.size()];
+	}
+	return checksum;
+}
+
+template <typename Decoder>
+void benchmark(char const* name, Decoder decoder)
+{
+	uint32_t checksum = 0;
+	auto start = Clock::now();
+	for (int round = 0; round < BENCHMARK_ROUNDS; ++round)
+		checksum += decoder();
+	auto end = Clock::now();
+
+	auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+	auto per_frame = static_cast<double>(nanoseconds) / (BENCHMARK_ROUNDS * FRAME_COUNT);
+	std::cout << std::left << std::setw(12) << name << std::right << std::fixed << std::setprecision(1)
+			  << std::setw(10) << per_frame << " ns/frame (checksum " << checksum << ")" << std::endl;
+}
+
+constexpr char const* MODE_NAMES[] = { "nibble", "nibble delta", "nibble snake", "pokemon", "pokemon delta", "pokemon snake", "turtle" };
+constexpr size_t MODE_COUNT = sizeof(MODE_NAMES) / sizeof(*MODE_NAMES);
+
+double percentile(std::vector<double> const& sorted_values, double fraction)
+{
+	auto const index = static_cast<size_t>(fraction * (sorted_values.size() - 1) + 0.5);
+	return sorted_values[index];
+}
+
+struct DecodeCost {
+	double base { 0 };
+	double per_byte { 0 };
+	size_t frame_count { 0 };
+};
+
+// Least-squares fit of the decode time as a linear function of the frame size. Without a usable slope (too few frames, or
+// sizes that don't vary), the time is treated as constant.
+DecodeCost fit_decode_cost(std::vector<double> const& sizes, std::vector<double> const& times)
+{
+	DecodeCost cost { 0, 0, times.size() };
+	if (times.empty())
+		return cost;
+	double mean_size = 0;
+	double mean_time = 0;
+	for (size_t i = 0; i < times.size(); ++i) {
+		mean_size += sizes[i];
+		mean_time += times[i];
+	}
+	mean_size /= times.size();
+	mean_time /= times.size();
+	double covariance = 0;
+	double variance = 0;
+	for (size_t i = 0; i < times.size(); ++i) {
+		covariance += (sizes[i] - mean_size) * (times[i] - mean_time);
+		variance += (sizes[i] - mean_size) * (sizes[i] - mean_size);
+	}
+	// noise may produce a negative slope for modes whose time hardly depends on the size
+	cost.per_byte = variance > 0 ? std::max(covariance / variance, 0.0) : 0;
+	cost.base = mean_time - cost.per_byte * mean_size;
+	if (cost.base < 0) {
+		// or a negative base time, in which case the time is taken to be proportional to the size
+		double size_squares = 0;
+		double products = 0;
+		for (size_t i = 0; i < times.size(); ++i) {
+			size_squares += sizes[i] * sizes[i];
+			products += sizes[i] * times[i];
+		}
+		cost.base = 0;
+		cost.per_byte = products / size_squares;
+	}
+	return cost;
+}
+
+// Times every frame while decoding the video in order, and reports the distribution of frame decode times per compression mode.
+// Each frame's time is the minimum over all rounds, which removes most of the scheduling noise.
+void benchmark_modes()
+{
+	std::vector<double> frame_nanoseconds(FRAME_COUNT, std::numeric_limits<double>::max());
+	alignas(uint32_t) static std::array<std::array<uint8_t, (FRAME_SIZE + 3) & ~3>, 2> buffers {};
+	for (int round = 0; round < BENCHMARK_ROUNDS; ++round) {
+		buffers[1].fill(0);
+		size_t current = 0;
+		for (size_t i = 0; i < FRAME_COUNT; ++i) {
+			auto& output = buffers[current];
+			auto const& previous = buffers[1 - current];
+			auto start = Clock::now();
+			SRLV::decompress_into<IMAGE_WIDTH, IMAGE_HEIGHT>({ output.data(), output.size() }, { frames[i], frame_sizes[i] }, { previous.data(), previous.size() });
+			auto end = Clock::now();
+			auto const nanoseconds = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+			frame_nanoseconds[i] = std::min(frame_nanoseconds[i], nanoseconds);
+			current = 1 - current;
+		}
+	}
+
+	std::cout << std::endl
+			  << std::left << std::setw(14) << "mode" << std::right << std::setw(7) << "frames" << std::setw(9) << "bytes"
+			  << std::setw(10) << "mean ns" << std::setw(10) << "p50" << std::setw(10) << "p90" << std::setw(10) << "p99" << std::setw(10) << "max"
+			  << std::setw(10) << "in MB/s" << std::setw(10) << "out MB/s" << std::endl;
+
+	auto print_row = [](char const* name, std::vector<double> times, size_t compressed_size) {
+		if (times.empty())
+			return;
+		std::sort(times.begin(), times.end());
+		double total = 0;
+		for (auto const time : times)
+			total += time;
+		auto const mean = total / times.size();
+		// bytes per nanosecond = GB/s
+		auto const input_rate = compressed_size / total * 1000;
+		auto const output_rate = static_cast<double>(FRAME_SIZE * times.size()) / total * 1000;
+		std::cout << std::left << std::setw(14) << name << std::right << std::setw(7) << times.size()
+				  << std::fixed << std::setprecision(1) << std::setw(9) << static_cast<double>(compressed_size) / times.size()
+				  << std::setw(10) << mean << std::setw(10) << percentile(times, 0.5) << std::setw(10) << percentile(times, 0.9)
+				  << std::setw(10) << percentile(times, 0.99) << std::setw(10) << times.back()
+				  << std::setw(10) << input_rate << std::setw(10) << output_rate << std::endl;
+	};
+
+	std::vector<double> all_times;
+	size_t all_compressed_size = 0;
+	std::array<DecodeCost, MODE_COUNT> costs {};
+	for (size_t mode = 0; mode < MODE_COUNT; ++mode) {
+		std::vector<double> times;
+		std::vector<double> sizes;
+		size_t compressed_size = 0;
+		for (size_t i = 0; i < FRAME_COUNT; ++i) {
+			if (frames[i][0] != mode)
+				continue;
+			times.push_back(frame_nanoseconds[i]);
+			sizes.push_back(frame_sizes[i]);
+			compressed_size += frame_sizes[i];
+		}
+		all_times.insert(all_times.end(), times.begin(), times.end());
+		all_compressed_size += compressed_size;
+		costs[mode] = fit_decode_cost(sizes, times);
+		print_row(MODE_NAMES[mode], times, compressed_size);
+	}
+	print_row("all", all_times, all_compressed_size);
+
+	// the encoder's decode_cost_model, which only needs updating after decoder changes
+	std::cout << std::endl
+			  << "decode cost model (ns = base + per byte * frame bytes):" << std::endl;
+	for (size_t mode = 0; mode < MODE_COUNT; ++mode) {
+		if (costs[mode].frame_count == 0)
+			continue;
+		std::cout << "    " << mode << ": (" << std::fixed << std::setprecision(1) << costs[mode].base
+				  << ", " << std::setprecision(2) << costs[mode].per_byte << "),  # " << MODE_NAMES[mode]
+				  << ", " << costs[mode].frame_count << " frames" << std::endl;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	// print a single frame, decoded with all of its predecessors
+	if (argc > 1) {
+		auto const frame_index = static_cast<size_t>(std::atol(argv[1])) % FRAME_COUNT;
+		std::vector<uint8_t> image(FRAME_SIZE);
+		for (size_t i = 0; i <= frame_index; ++i)
+			image = SRLV::decompress<IMAGE_WIDTH, IMAGE_HEIGHT>({ frames[i], frame_sizes[i] }, image);
+		print_xbm(image);
+		return 0;
+	}
+
+	// benchmarks of broken decoders are pointless
+	if (!verify_golden() || !validate_frames())
+		return 1;
+
+	std::cout << FRAME_COUNT << " frames, " << BENCHMARK_ROUNDS << " rounds" << std::endl;
+	benchmark("allocating", decode_allocating);
+	benchmark("ping-pong", decode_ping_pong);
+	benchmark("validated", decode_validated);
+	benchmark("tiles", decode_to_tiles);
+	benchmark("read bytes", read_bytewise);
+	benchmark("read words", read_wordwise);
+	// Both read loops run from the L1 cache here, while every load on the ESP8266 goes through the much slower flash cache.
+	size_t byte_loads = 0;
+	size_t word_loads = 0;
+	for (size_t i = 0; i < FRAME_COUNT; ++i) {
+		byte_loads += frame_sizes[i];
+		word_loads += (reinterpret_cast<FlatPtr>(frames[i]) % sizeof(uint32_t) + frame_sizes[i] + 3) / sizeof(uint32_t);
+	}
+	std::cout << "flash loads per video: " << byte_loads << " bytewise, " << word_loads << " wordwise" << std::endl;
+	benchmark("write bits", write_runs_bitwise);
+	benchmark("write words", write_runs_word_wise);
+	benchmark_modes();
+	GainStage steady_gain;
+	steady_gain.set_volume(GainStage::volume_from_percent(70));
+	benchmark_gain_stage("gain steady", steady_gain);
+	GainStage fading_gain;
+	// longer than the benchmark, so that every block computes a curve point
+	fading_gain.start_fade({ 60, FadeCurve::SmoothStep });
+	benchmark_gain_stage("gain fade-in", fading_gain);
+	// On the host, a yield only happens when a single frame takes longer than the whole budget.
+	auto const& video_yields = yield_stats_for(YieldSubsystem::Video);
+	std::cout << "video yields: " << video_yields.yields << " of " << video_yields.checks << " checks" << std::endl;
+	return 0;
 }
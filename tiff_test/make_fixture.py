@@ -0,0 +1,86 @@
+"""
+Writes fixture.h, a small synthetic video that covers the compression modes, and golden_checksums.txt with the checksums
+of its source frames. The checksums come from the pixels that went into the encoder, so they don't depend on the decoder.
+Run from this directory whenever the encoder's output format changes: python make_fixture.py
+"""
+
+import importlib.util
+from collections import defaultdict
+from pathlib import Path
+import sys
+
+from PIL import Image, ImageDraw
+
+compression_path = Path(__file__).resolve().parent.parent / "compression"
+# the encoder imports its sibling modules by name
+sys.path.insert(0, str(compression_path))
+spec = importlib.util.spec_from_file_location("encoder", compression_path / "__main__.py")
+encoder = importlib.util.module_from_spec(spec)
+spec.loader.exec_module(encoder)
+
+width = encoder.x_block_size
+height = encoder.y_block_size
+# Encoder numbers in the order they are used, one frame each, for a few rounds. Delta modes need a predecessor,
+# so the sequence starts with a keyframe mode.
+fixture_modes = [0, 1, 2, 3, 4, 5, 6]
+fixture_rounds = 4
+
+
+def draw_frame(index: int) -> Image.Image:
+    """A moving circle and bar with some scattered pixels; every third frame is inverted."""
+    image = Image.new(mode="1", size=(width, height), color=0)
+    draw = ImageDraw.Draw(image)
+    x = 8 + index * 3 % (width - 24)
+    radius = 6 + index % 5
+    draw.ellipse((x, 14, x + 2 * radius, 14 + 2 * radius), fill=1)
+    draw.rectangle((0, 50 - index % 7, index * 5 % width, 54), fill=1)
+    draw.line((width - 1, 0, index * 7 % width, height - 1), fill=1)
+    # deterministic noise, which the Turtle encoder stores as single pixels
+    state = index + 1
+    for _ in range(12):
+        state = (state * 1103515245 + 12345) % 2**31
+        image.putpixel((state % width, state // width % height), 1)
+    if index % 3 == 2:
+        image = Image.eval(image.convert("L"), lambda value: 255 - value).convert("1")
+    return image
+
+
+def frame_checksum(pixels: bytes) -> int:
+    """FNV-1a, like frame_checksum in main.cpp."""
+    checksum = 2166136261
+    for byte in pixels:
+        checksum = ((checksum ^ byte) * 16777619) % 2**32
+    return checksum
+
+
+def main():
+    delta_counts: dict[int, int] = defaultdict(int)
+    distance_counts: dict[int, int] = defaultdict(int)
+    c_arrays = ""
+    checksums = ""
+    previous = Image.new(mode="1", size=(width, height), color=0)
+    frame_count = len(fixture_modes) * fixture_rounds
+    for index in range(frame_count):
+        image = draw_frame(index)
+        mode = fixture_modes[index % len(fixture_modes)]
+        candidates = encoder.encode_block_candidates(image, previous, delta_counts, distance_counts, index)
+        c_arrays += encoder.bytes_to_c_array(bytes([mode]) + candidates[mode], f"frame_{index}") + "\n"
+        # the decoders' frame layout: rows of bytes with the leftmost pixel in the lowest bit
+        pixels = bytes(encoder.reverse_mask(byte) for byte in image.tobytes())
+        checksums += f"{frame_checksum(pixels):08x}\n"
+        previous = image
+
+    names = [f"frame_{index}" for index in range(frame_count)]
+    Path("fixture.h").write_text(
+        "// Generated by make_fixture.py.\n"
+        + c_arrays
+        + f"\nstatic unsigned char* frames[] PROGMEM = {{ {', '.join(names)} }};\n"
+        + f"\nstatic size_t frame_sizes[] PROGMEM = {{ {', '.join(f'sizeof({name})' for name in names)} }};\n",
+        encoding="utf-8",
+    )
+    Path("golden_checksums.txt").write_text(checksums, encoding="utf-8")
+    print(f"wrote {frame_count} frames")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,25 @@
+// Host stand-in for the parts of the Arduino core that the tested sources use.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+class String {
+public:
+	String() = default;
+	String(char const* text)
+		: text(text)
+	{
+	}
+
+	void concat(char c) { text += c; }
+	void concat(char const* data, size_t length) { text.append(data, length); }
+	size_t length() const { return text.size(); }
+	char const* c_str() const { return text.c_str(); }
+
+private:
+	std::string text;
+};
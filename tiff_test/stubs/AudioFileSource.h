@@ -0,0 +1,19 @@
+// Host stand-in for ESP8266Audio's AudioFileSource.
+
+#pragma once
+
+#include <Arduino.h>
+#include <cstdint>
+#include <cstdio>
+
+class AudioFileSource {
+public:
+	virtual ~AudioFileSource() = default;
+	virtual bool open(char const*) { return false; }
+	virtual uint32_t read(void* data, uint32_t len) = 0;
+	virtual bool seek(int32_t, int) { return false; }
+	virtual bool close() { return false; }
+	virtual bool isOpen() { return false; }
+	virtual uint32_t getSize() { return 0; }
+	virtual uint32_t getPos() { return 0; }
+};
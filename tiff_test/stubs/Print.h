@@ -0,0 +1,13 @@
+// Host stand-in for the Arduino core's Print.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class Print {
+public:
+	virtual ~Print() = default;
+	virtual size_t write(uint8_t c) = 0;
+	virtual size_t write(uint8_t const* data, size_t length) = 0;
+};
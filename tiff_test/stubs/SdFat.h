@@ -0,0 +1,142 @@
+// Host stand-in for SdFat: a card made of a sector image, with files stored in runs of sectors and raw sector reads that can be made to fail.
+
+#pragma once
+
+#include <Print.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#define O_RDONLY 0
+
+constexpr uint32_t STUB_SECTOR_SIZE = 512;
+
+class SdCard {
+public:
+	bool readSectors(uint32_t sector, uint8_t* data, size_t count)
+	{
+		if (sector_reads++ >= failing_after || (sector + count) * STUB_SECTOR_SIZE > image.size())
+			return false;
+		memcpy(data, image.data() + sector * STUB_SECTOR_SIZE, count * STUB_SECTOR_SIZE);
+		return true;
+	}
+
+	std::vector<uint8_t> image;
+	// readSectors calls so far; calls fail from failing_after on, like a card that stopped responding
+	size_t sector_reads { 0 };
+	size_t failing_after { SIZE_MAX };
+	// FsFile::read calls so far
+	size_t file_reads { 0 };
+};
+
+// A file's data lies in runs of consecutive sectors; a single run makes a contiguous file.
+struct StubFile {
+	struct Run {
+		uint32_t first_sector;
+		uint32_t sector_count;
+	};
+	uint32_t size;
+	std::vector<Run> runs;
+};
+
+class FsFile {
+public:
+	FsFile() = default;
+	FsFile(SdCard* card, StubFile const* file)
+		: card(card)
+		, file(file)
+	{
+	}
+
+	explicit operator bool() const { return file != nullptr; }
+	bool isOpen() const { return file != nullptr; }
+	void close() { file = nullptr; }
+
+	// Reads through the file system, i.e. sector by sector along the runs. These reads always succeed, like a retry that works.
+	int read(void* data, size_t length)
+	{
+		++card->file_reads;
+		auto* output = static_cast<uint8_t*>(data);
+		auto const end = std::min<uint64_t>(file_position + length, file->size);
+		int total_read = 0;
+		while (file_position < end) {
+			auto const sector_offset = file_position % STUB_SECTOR_SIZE;
+			auto const piece = std::min<uint64_t>(end - file_position, STUB_SECTOR_SIZE - sector_offset);
+			memcpy(output + total_read, card->image.data() + image_offset(file_position), piece);
+			file_position += piece;
+			total_read += static_cast<int>(piece);
+		}
+		return total_read;
+	}
+
+	bool seek(uint64_t new_position)
+	{
+		if (new_position > file->size)
+			return false;
+		file_position = new_position;
+		return true;
+	}
+	uint64_t position() const { return file_position; }
+	uint64_t size() const { return file->size; }
+	uint64_t fileSize() const { return file->size; }
+	size_t printName(Print*) { return 0; }
+
+	bool contiguousRange(uint32_t* first_sector, uint32_t* last_sector)
+	{
+		if (file->runs.size() != 1)
+			return false;
+		*first_sector = file->runs[0].first_sector;
+		*last_sector = file->runs[0].first_sector + file->runs[0].sector_count - 1;
+		return true;
+	}
+
+private:
+	size_t image_offset(uint64_t file_offset) const
+	{
+		auto sector = static_cast<uint32_t>(file_offset / STUB_SECTOR_SIZE);
+		for (auto const& run : file->runs) {
+			if (sector < run.sector_count)
+				return (run.first_sector + sector) * STUB_SECTOR_SIZE + file_offset % STUB_SECTOR_SIZE;
+			sector -= run.sector_count;
+		}
+		return 0;
+	}
+
+	SdCard* card { nullptr };
+	StubFile const* file { nullptr };
+	uint64_t file_position { 0 };
+};
+
+class SdFs {
+public:
+	SdCard* card() { return &the_card; }
+
+	FsFile open(char const* name, int)
+	{
+		auto const file = files.find(name);
+		if (file == files.end())
+			return {};
+		return { &the_card, &file->second };
+	}
+
+	// Stores the data in the given runs, which must have room for it, and makes it available under the name.
+	void add_file(std::string const& name, std::vector<uint8_t> const& data, std::vector<StubFile::Run> runs)
+	{
+		uint32_t data_offset = 0;
+		for (auto const& run : runs) {
+			auto const run_end = (run.first_sector + run.sector_count) * STUB_SECTOR_SIZE;
+			if (the_card.image.size() < run_end)
+				the_card.image.resize(run_end, 0xEE);
+			auto const length = std::min<size_t>(data.size() - data_offset, run.sector_count * STUB_SECTOR_SIZE);
+			memcpy(the_card.image.data() + run.first_sector * STUB_SECTOR_SIZE, data.data() + data_offset, length);
+			data_offset += length;
+		}
+		files[name] = { static_cast<uint32_t>(data.size()), std::move(runs) };
+	}
+
+	SdCard the_card;
+	std::map<std::string, StubFile> files;
+};
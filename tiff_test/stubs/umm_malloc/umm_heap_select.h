@@ -0,0 +1,5 @@
+// Host stand-in for the ESP8266 core's heap selection; the host only has one heap.
+
+#pragma once
+
+struct HeapSelectIram { };